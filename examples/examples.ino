@@ -11,7 +11,7 @@ bool systemPower = false, ledState = false, fanState = false;
 
 void toggleLED() {
   ledState = !ledState;
-  dashboard.updateCard("led_status", ledState ? "ON" : "OFF", ledState ? "Operation successful" : "LED turned off");
+  dashboard.updateCard("led_status", ledState, ledState ? "Operation successful" : "LED turned off");
   Serial.printf("[ACTION] LED toggled to %s\n", ledState ? "ON" : "OFF");
 }
 
@@ -78,7 +78,7 @@ void setup() {
 
   dashboard.addSwitch("LED Control", "Main Light", [](bool state) {
     ledState = state;
-    dashboard.updateCard("custom_0", ledState ? "ON" : "OFF", ledState ? "Operation successful" : "LED turned off");
+    dashboard.updateCard("custom_0", ledState, ledState ? "Operation successful" : "LED turned off");
   }, "yellow");
 
   dashboard.addButton("Toggle LED", "Change light state", toggleLED, "orange");
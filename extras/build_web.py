@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Build the dashboard web UI into src/DashboardAssets.h.
+
+Minifies extras/web/app.css, app.js and index.html, gzips them and writes
+the result as PROGMEM byte arrays. Run it after editing anything in
+extras/web/ and commit the regenerated header together with the sources:
+
+    python3 extras/build_web.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "extras", "web")
+OUTPUT = os.path.join(ROOT, "src", "DashboardAssets.h")
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};,>])\s*", r"\1", text)
+    text = re.sub(r":\s+", ":", text)
+    text = text.replace(";}", "}")
+    return text.strip()
+
+
+def minify_js(text):
+    # Line-based on purpose: drops indentation, blank lines and whole-line
+    # comments but never touches code, so no parser is needed and newlines
+    # stay where automatic semicolon insertion expects them.
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def strip_debug(text):
+    # Production bundle: drop every single-line debug(...) statement so
+    # neither the call nor its argument formatting survives.
+    text = re.sub(r"^[ \t]*debug\(.*\);[ \t]*\n", "", text, flags=re.M)
+    leftover = re.search(r"^.*\bdebug\((?!\.\.\.args\)).*$", text, flags=re.M)
+    if leftover:
+        raise SystemExit("app.js: debug() call not stripped (keep them on one line): %s"
+                         % leftover.group(0).strip())
+    return text
+
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    text = re.sub(r">\s+<", "><", text)
+    text = re.sub(r"\s+", " ", text)
+    return text.strip()
+
+
+def read(name):
+    with open(os.path.join(WEB_DIR, name), encoding="utf-8") as f:
+        return f.read()
+
+
+def compress(text):
+    # mtime=0 keeps the output byte-identical between runs
+    return gzip.compress(text.encode("utf-8"), compresslevel=9, mtime=0)
+
+
+def version(data):
+    return hashlib.sha1(data).hexdigest()[:8]
+
+
+def c_array(name, data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]))
+    return "const uint8_t %s[] PROGMEM = {\n%s\n};\nconst size_t %s_LEN = %d;\n" % (
+        name, ",\n".join(rows), name, len(data))
+
+
+def main():
+    assets = []
+
+    css = minify_css(read("app.css"))
+    css_version = version(css.encode("utf-8"))
+    assets.append(("APP_CSS", "app.css", css, css_version))
+
+    js = minify_js(strip_debug(read("app.js")))
+    js_version = version(js.encode("utf-8"))
+    assets.append(("APP_JS", "app.js", js, js_version))
+
+    debug_js = minify_js(read("app.js"))
+    debug_js_version = version(debug_js.encode("utf-8"))
+    assets.append(("APP_DEBUG_JS", "app.js", debug_js, debug_js_version))
+
+    # The shell references the other assets by content hash so they can be
+    # cached forever; it is the only file browsers need to revalidate.
+    html = read("index.html")
+    html = html.replace("{{APP_CSS_VERSION}}", css_version)
+    html = html.replace("{{APP_JS_VERSION}}", js_version)
+    html = html.replace("{{APP_DEBUG_JS_VERSION}}", debug_js_version)
+    html = minify_html(html)
+    assets.append(("INDEX_HTML", "index.html", html, version(html.encode("utf-8"))))
+
+    out = [
+        "// Generated by extras/build_web.py from extras/web/ - do not edit by hand.\n",
+        "#ifndef DASHBOARD_ASSETS_H\n",
+        "#define DASHBOARD_ASSETS_H\n\n",
+        "#include <Arduino.h>\n\n",
+    ]
+    for name, source, text, ver in assets:
+        data = compress(text)
+        out.append("#define DASHBOARD_%s_VERSION \"%s\"\n" % (name, ver))
+        out.append(c_array("DASHBOARD_%s_GZ" % name, data))
+        out.append("\n")
+        print("%-10s %6d bytes -> %6d minified -> %5d gzipped" % (
+            source, len(read(source).encode("utf-8")), len(text.encode("utf-8")), len(data)))
+    out.append("#endif\n")
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,140 @@
+"""Minimal dashboard client for the host-side tools in extras/ (stdlib only).
+
+WebSocket is a bare RFC 6455 client with just what the dashboard uses:
+text and binary messages, ping/pong and close. Not meant as a general
+purpose library.
+"""
+
+import base64
+import json
+import os
+import socket
+import struct
+import urllib.error
+import urllib.request
+
+
+class WebSocket:
+    def __init__(self, host, port=81, path="/", timeout=10):
+        self.sock = socket.create_connection((host, port), timeout=timeout)
+        key = base64.b64encode(os.urandom(16)).decode()
+        request = ("GET %s HTTP/1.1\r\nHost: %s:%d\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                   "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n") % (path, host, port, key)
+        self.sock.sendall(request.encode())
+
+        response = b""
+        while b"\r\n\r\n" not in response:
+            chunk = self.sock.recv(1024)
+            if not chunk:
+                raise ConnectionError("WebSocket handshake: connection closed")
+            response += chunk
+        head, _, self.buffer = response.partition(b"\r\n\r\n")
+        status = head.split(b"\r\n", 1)[0]
+        if b" 101 " not in status + b" ":
+            raise ConnectionError("WebSocket handshake failed: %s" % status.decode(errors="replace"))
+
+    def _read(self, count):
+        while len(self.buffer) < count:
+            chunk = self.sock.recv(4096)
+            if not chunk:
+                raise ConnectionError("connection closed")
+            self.buffer += chunk
+        data, self.buffer = self.buffer[:count], self.buffer[count:]
+        return data
+
+    def send(self, message, opcode=None):
+        payload = message.encode() if isinstance(message, str) else bytes(message)
+        if opcode is None:
+            opcode = 0x1 if isinstance(message, str) else 0x2
+
+        # Client frames are always masked
+        header = bytearray([0x80 | opcode])
+        length = len(payload)
+        if length < 126:
+            header.append(0x80 | length)
+        elif length < 65536:
+            header.append(0x80 | 126)
+            header += struct.pack(">H", length)
+        else:
+            header.append(0x80 | 127)
+            header += struct.pack(">Q", length)
+        mask = os.urandom(4)
+        header += mask
+        masked = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+        self.sock.sendall(bytes(header) + masked)
+
+    def receive(self):
+        """Next message: str for text, bytes for binary, None once closed."""
+        message = b""
+        opcode = None
+        while True:
+            first, second = self._read(2)
+            frame_opcode = first & 0x0F
+            length = second & 0x7F
+            if length == 126:
+                length = struct.unpack(">H", self._read(2))[0]
+            elif length == 127:
+                length = struct.unpack(">Q", self._read(8))[0]
+            mask = self._read(4) if second & 0x80 else None
+            payload = self._read(length)
+            if mask:
+                payload = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+
+            if frame_opcode == 0x8:
+                return None
+            if frame_opcode == 0x9:
+                self.send(payload, 0xA)
+                continue
+            if frame_opcode == 0xA:
+                continue
+
+            if frame_opcode != 0x0:
+                opcode = frame_opcode
+            message += payload
+            if first & 0x80:
+                return message.decode("utf-8") if opcode == 0x1 else message
+
+    def close(self):
+        try:
+            self.send(b"", 0x8)
+        except OSError:
+            pass
+        self.sock.close()
+
+
+def http_json(host, port, path, body=None, timeout=10):
+    """GET (or POST body as JSON) and return (status, parsed response)."""
+    url = "http://%s:%d%s" % (host, port, path)
+    data = None if body is None else (body if isinstance(body, str) else json.dumps(body)).encode()
+    request = urllib.request.Request(url, data=data, headers={"Content-Type": "application/json"})
+    try:
+        with urllib.request.urlopen(request, timeout=timeout) as response:
+            text = response.read().decode()
+            status = response.status
+    except urllib.error.HTTPError as error:
+        text = error.read().decode()
+        status = error.code
+    try:
+        return status, json.loads(text)
+    except ValueError:
+        return status, text
+
+
+# Binary command protocol (src/DashboardCommand.h)
+COMMAND_MAGIC = 0xDC
+COMMAND_TOGGLE = 1
+COMMAND_CLICK = 2
+COMMAND_SLIDE = 3
+COMMAND_MOVE = 4
+COMMAND_SET = 5
+AXIS_SCALE = 32767
+
+
+def command(opcode, handle, value=0.0):
+    """Encode a binary control command for the control with the given handle."""
+    return struct.pack("<BBHf", COMMAND_MAGIC, opcode, handle, value)
+
+
+def move_command(handle, x, y):
+    """Encode a joystick move; x and y in -1..1."""
+    return struct.pack("<BBHhh", COMMAND_MAGIC, COMMAND_MOVE, handle, round(x * AXIS_SCALE), round(y * AXIS_SCALE))
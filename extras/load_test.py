@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""Multi-client load benchmark for a dashboard device.
+
+Opens N WebSocket clients, has them take turns moving one slider and
+measures how long it takes until every client sees the new value (fan-out
+latency), how many broadcast frames each client missed (gaps in "seq") and
+what the device heap does (/api/stats). Pass a list of client counts to
+find where a device stops keeping up:
+
+    python3 extras/load_test.py <device-ip> --clients 1,2,4,8 --duration 30
+
+The slider's callback runs for every action, so point --control at a slider
+that is safe to move (the first slider of the layout is used by default).
+--binary sends the actions as binary commands instead of JSON.
+"""
+
+import argparse
+import json
+import threading
+import time
+
+from dashboard_client import COMMAND_SLIDE, WebSocket, command, http_json
+
+
+class Client:
+    def __init__(self, index, host, port, control, run):
+        self.index = index
+        self.control = control
+        self.run = run
+        self.frames = 0
+        self.lost = 0
+        self.last_seq = None
+        self.ws = WebSocket(host, port)
+        self.thread = threading.Thread(target=self._read, daemon=True)
+        self.thread.start()
+
+    def _read(self):
+        try:
+            while True:
+                message = self.ws.receive()
+                if message is None:
+                    return
+                self._handle(json.loads(message), time.monotonic())
+        except (OSError, ConnectionError, ValueError):
+            return
+
+    def _handle(self, frame, received):
+        self.frames += 1
+
+        seq = frame.get("seq")
+        if seq is not None:
+            if self.last_seq is not None and seq > self.last_seq + 1:
+                self.lost += seq - self.last_seq - 1
+            self.last_seq = seq
+
+        for control in frame.get("controls", []):
+            if control.get("id") == self.control:
+                self.run.observed(control.get("value"), received)
+
+    def close(self):
+        self.ws.close()
+        self.thread.join(timeout=2)
+
+
+class Run:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.pending = {}
+        self.latencies = []
+
+    def sent(self, value):
+        with self.lock:
+            self.pending[value] = time.monotonic()
+
+    def observed(self, value, received):
+        with self.lock:
+            sent = self.pending.get(value)
+            if sent is not None:
+                self.latencies.append(received - sent)
+
+
+def percentile(values, p):
+    if not values:
+        return float("nan")
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(round(p / 100.0 * (len(ordered) - 1))))]
+
+
+def find_slider(args):
+    status, layout = http_json(args.host, args.port, "/api/layout")
+    if status != 200:
+        raise SystemExit("Could not read /api/layout (HTTP %d)" % status)
+    for control in layout.get("controls", []):
+        if control["type"] == 3 and (args.control is None or control["id"] == args.control):
+            return control
+    raise SystemExit("No slider%s in the layout; load_test needs one to drive" % (
+        " '%s'" % args.control if args.control else ""))
+
+
+def heap(args):
+    status, stats = http_json(args.host, args.port, "/api/stats")
+    return stats.get("heap", {}) if status == 200 else {}
+
+
+def run_clients(args, slider, count):
+    run = Run()
+    clients = []
+    failed = 0
+    for index in range(count):
+        try:
+            clients.append(Client(index, args.host, args.ws_port, slider["id"], run))
+        except (OSError, ConnectionError):
+            failed += 1
+    if not clients:
+        return None
+
+    heap_start = heap(args)
+    min_free = heap_start.get("free", 0)
+    min_alloc = heap_start.get("maxAlloc", 0)
+
+    low, high = slider.get("min", 0), slider.get("max", 100)
+    span = max(1, high - low + 1)
+    actions = 0
+    start = time.monotonic()
+    next_stats = start + 2
+    while time.monotonic() - start < args.duration:
+        value = low + actions % span
+        run.sent(value)
+        sender = clients[actions % len(clients)]
+        try:
+            if args.binary:
+                sender.ws.send(command(COMMAND_SLIDE, slider["handle"], value))
+            else:
+                sender.ws.send(json.dumps({"id": slider["id"], "action": "slide", "value": value}))
+        except OSError:
+            pass
+        actions += 1
+
+        if time.monotonic() >= next_stats:
+            current = heap(args)
+            min_free = min(min_free, current.get("free", min_free))
+            min_alloc = min(min_alloc, current.get("maxAlloc", min_alloc))
+            next_stats += 2
+        time.sleep(1.0 / args.rate)
+
+    # Let the last updates arrive
+    time.sleep(1.0)
+    for client in clients:
+        client.close()
+
+    return {
+        "clients": len(clients),
+        "failed": failed,
+        "actions": actions,
+        "latencies": run.latencies,
+        "expected": actions * len(clients),
+        "frames": sum(c.frames for c in clients),
+        "lost": sum(c.lost for c in clients),
+        "min_free": min_free,
+        "min_alloc": min_alloc,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("host", help="device address")
+    parser.add_argument("--clients", default="1,2,4", help="comma separated client counts to run")
+    parser.add_argument("--duration", type=float, default=20, help="seconds per client count")
+    parser.add_argument("--rate", type=float, default=5, help="control actions per second")
+    parser.add_argument("--control", help="id of the slider to drive")
+    parser.add_argument("--binary", action="store_true", help="send binary commands instead of JSON")
+    parser.add_argument("--port", type=int, default=80, help="HTTP port")
+    parser.add_argument("--ws-port", type=int, default=81, help="WebSocket port")
+    args = parser.parse_args()
+
+    slider = find_slider(args)
+    print("Driving slider '%s' at %.1f actions/s, %.0f s per step (%s commands)" % (
+        slider["id"], args.rate, args.duration, "binary" if args.binary else "JSON"))
+    print("%7s %6s %7s %8s %8s %8s %8s %9s %7s %10s %10s" % (
+        "clients", "failed", "actions", "p50 ms", "p90 ms", "p99 ms", "max ms", "missing", "lost",
+        "heap min", "alloc min"))
+
+    for count in [int(c) for c in args.clients.split(",")]:
+        result = run_clients(args, slider, count)
+        if result is None:
+            print("%7d  could not connect any client" % count)
+            continue
+        latencies = [1000 * l for l in result["latencies"]]
+        print("%7d %6d %7d %8.1f %8.1f %8.1f %8.1f %9d %7d %10d %10d" % (
+            result["clients"], result["failed"], result["actions"],
+            percentile(latencies, 50), percentile(latencies, 90), percentile(latencies, 99),
+            max(latencies) if latencies else float("nan"),
+            result["expected"] - len(latencies), result["lost"],
+            result["min_free"], result["min_alloc"]))
+        time.sleep(1.0)
+
+
+if __name__ == "__main__":
+    main()
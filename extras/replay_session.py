@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Replay a recorded dashboard session against a live device.
+
+Record on the device with dashboard.startRecording(), download the session
+from /api/recording and replay its inbound traffic: every recorded
+WebSocket client becomes a real connection, opened and closed at the
+recorded times, and its messages and HTTP control requests are sent at the
+original pace (or scaled with --speed). Frames the device sends back are
+counted per connection, so the same recording doubles as a repeatable load
+benchmark:
+
+    curl http://<device-ip>/api/recording > session.jsonl
+    python3 extras/replay_session.py <device-ip> session.jsonl --speed 2
+"""
+
+import argparse
+import json
+import threading
+import time
+
+from dashboard_client import WebSocket, http_json
+
+
+class Connection:
+    def __init__(self, host, port):
+        self.ws = WebSocket(host, port)
+        self.frames = 0
+        self.bytes = 0
+        self.thread = threading.Thread(target=self._read, daemon=True)
+        self.thread.start()
+
+    def _read(self):
+        try:
+            while True:
+                message = self.ws.receive()
+                if message is None:
+                    return
+                self.frames += 1
+                self.bytes += len(message)
+        except (OSError, ConnectionError):
+            return
+
+    def close(self):
+        self.ws.close()
+        self.thread.join(timeout=2)
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        events = [json.loads(line) for line in f if line.strip()]
+    # Outbound frames in the recording are the device's output, not input
+    return [e for e in events if e["type"] != "frame"]
+
+
+def replay(args, events):
+    connections = {}
+    finished = []
+    sent = 0
+    http_times = []
+    errors = 0
+
+    start = time.monotonic()
+    base = events[0]["t"] if events else 0
+    for event in events:
+        delay = (event["t"] - base) / 1000.0 / args.speed - (time.monotonic() - start)
+        if delay > 0:
+            time.sleep(delay)
+
+        client = event.get("client")
+        try:
+            if event["type"] == "connect":
+                if client in connections:
+                    finished.append(connections.pop(client))
+                connections[client] = Connection(args.host, args.ws_port)
+            elif event["type"] == "disconnect":
+                if client in connections:
+                    connection = connections.pop(client)
+                    connection.close()
+                    finished.append(connection)
+            elif event["type"] == "ws":
+                # Messages of a client whose connect was trimmed off the
+                # recording open a connection on first use
+                if client not in connections:
+                    connections[client] = Connection(args.host, args.ws_port)
+                connections[client].ws.send(event["data"])
+                sent += 1
+            elif event["type"] == "http":
+                began = time.monotonic()
+                status, _ = http_json(args.host, args.port, "/api/control", event["data"])
+                http_times.append(time.monotonic() - began)
+                if status != 200:
+                    errors += 1
+        except (OSError, ConnectionError) as error:
+            errors += 1
+            print("t=%d ms %s (client %s): %s" % (event["t"] - base, event["type"], client, error))
+
+    # Give the device a moment to answer the last messages
+    time.sleep(1.0)
+    for connection in connections.values():
+        connection.close()
+        finished.append(connection)
+    elapsed = time.monotonic() - start
+
+    print("Replayed %d events in %.1f s (%.1fx)" % (len(events), elapsed, args.speed))
+    print("WebSocket: %d connections, %d messages sent, %d frames / %d bytes received" % (
+        len(finished), sent, sum(c.frames for c in finished), sum(c.bytes for c in finished)))
+    if http_times:
+        print("HTTP control: %d requests, avg %.1f ms, max %.1f ms" % (
+            len(http_times), 1000 * sum(http_times) / len(http_times), 1000 * max(http_times)))
+    print("Errors: %d" % errors)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("host", help="device address")
+    parser.add_argument("recording", help="JSON lines file from /api/recording")
+    parser.add_argument("--speed", type=float, default=1.0, help="time scale (2 = twice as fast)")
+    parser.add_argument("--port", type=int, default=80, help="HTTP port")
+    parser.add_argument("--ws-port", type=int, default=81, help="WebSocket port")
+    args = parser.parse_args()
+
+    replay(args, load(args.recording))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,918 @@
+let ws;
+let isDarkMode = false;
+let reconnectAttempts = 0;
+const maxReconnectAttempts = 5;
+const charts = {};
+const chartTimes = {};
+const captures = {};
+const seriesColors = {};
+
+const COLORS = {
+    blue: '#3b82f6', green: '#22c55e', orange: '#f97316', red: '#ef4444',
+    purple: '#a855f7', cyan: '#06b6d4', yellow: '#f59e0b'
+};
+let layoutVersion = -1;
+let layoutLoading = false;
+// Browser time minus device time; the smallest difference seen is the one
+// with the least network delay in it
+let clockOffset = null;
+let clockSynced = null;
+let lastSeq = null;
+
+const CARD_CHART = 6;
+const CARD_MULTI_CHART = 7;
+const CHART_COMPRESSION_XOR = 2;
+const CONTROL_SWITCH = 0;
+const CONTROL_BUTTON = 1;
+const CONTROL_POWER_BUTTON = 2;
+const CONTROL_SLIDER = 3;
+const CONTROL_JOYSTICK = 4;
+const CONTROL_SETPOINT = 5;
+
+// Binary command protocol (src/DashboardCommand.h); controls are addressed
+// by the handle the layout gives them
+const COMMAND_MAGIC = 0xDC;
+const COMMAND_TOGGLE = 1;
+const COMMAND_CLICK = 2;
+const COMMAND_SLIDE = 3;
+const COMMAND_MOVE = 4;
+const COMMAND_SET = 5;
+const AXIS_SCALE = 32767;
+const controlHandles = {};
+
+// Diagnostic logging. Every debug statement is removed from the
+// production bundle by extras/build_web.py; open the page with ?debug
+// to load the bundle that keeps them.
+function debug(...args) {
+    console.log(...args);
+}
+
+// The shell inserts this script dynamically, so the DOM may already be ready
+if (document.readyState === 'loading') {
+    document.addEventListener('DOMContentLoaded', startDashboard);
+} else {
+    startDashboard();
+}
+
+function startDashboard() {
+    loadTheme();
+    loadLayout().then(initWebSocket);
+}
+
+function loadLayout() {
+    layoutLoading = true;
+    return fetch('/api/layout')
+        .then(response => response.json())
+        .then(renderLayout)
+        .catch(error => console.error('❌ Error loading layout:', error))
+        .then(() => { layoutLoading = false; });
+}
+
+function renderLayout(layout) {
+    debug('🧩 Rendering layout v' + layout.version);
+
+    document.title = layout.title;
+    document.getElementById('dashboardTitle').textContent = layout.title;
+    document.getElementById('dashboardSubtitle').textContent = layout.subtitle;
+    document.getElementById('cardsContainer').innerHTML = layout.cards.map(renderCard).join('');
+    document.getElementById('controlsContainer').innerHTML = layout.controls.map(renderControl).join('');
+
+    layoutVersion = layout.version;
+}
+
+// Frames only carry what changed, so a freshly rendered layout needs a full set of values
+function requestSnapshot() {
+    if (ws && ws.readyState === WebSocket.OPEN) {
+        ws.send(JSON.stringify({ type: 'snapshot' }));
+    }
+}
+
+function escapeHtml(text) {
+    return String(text).replace(/[&<>"']/g, c => ({
+        '&': '&amp;', '<': '&lt;', '>': '&gt;', '"': '&quot;', "'": '&#39;'
+    })[c]);
+}
+
+function renderCard(card) {
+    const id = escapeHtml(card.id);
+    const header = `
+        <div class="card-header">
+            <div class="card-icon">${escapeHtml(card.icon)}</div>
+            <div class="card-info">
+                <h3 class="card-title">${escapeHtml(card.title)}</h3>
+                <p class="card-description">${escapeHtml(card.description)}</p>
+            </div>
+        </div>`;
+
+    if (card.type === CARD_CHART || card.type === CARD_MULTI_CHART) {
+        let legend = '';
+        if (card.type === CARD_MULTI_CHART) {
+            seriesColors[card.id] = card.series.map(series => COLORS[series.color] || series.color);
+            legend = `
+        <div class="chart-legend">${card.series.map(series => `
+            <span class="legend-item"><i class="legend-swatch bg-${escapeHtml(series.color)}"></i>${escapeHtml(series.label)}</span>`).join('')}
+        </div>`;
+        }
+
+        return `
+    <div class="dashboard-card chart-card" id="${id}_card">${header}
+        <div class="chart-container">
+            <canvas id="${id}_chart" class="chart-canvas"></canvas>
+        </div>${legend}
+        <div class="card-footer">
+            <span class="card-value text-${escapeHtml(card.color)}" id="${id}_value">--</span>
+            <span class="card-status" id="${id}_status"></span>
+        </div>
+    </div>`;
+    }
+
+    return `
+    <div class="dashboard-card" id="${id}_card">${header}
+        <div class="card-content">
+            <div class="card-value text-${escapeHtml(card.color)}" id="${id}_value">--</div>
+            <div class="card-status" id="${id}_status"></div>
+        </div>
+    </div>`;
+}
+
+function renderControl(control) {
+    controlHandles[control.id] = control.handle;
+    const id = escapeHtml(control.id);
+    const title = escapeHtml(control.title);
+    const description = escapeHtml(control.description);
+
+    if (control.type === CONTROL_POWER_BUTTON) {
+        return `
+    <div class="control-card power-control" id="${id}_control">
+        <div class="control-header">
+            <h3>${title}</h3>
+            <p>${description}</p>
+        </div>
+        <div class="power-button-container">
+            <button class="power-button" id="${id}" onclick="toggleControl('${id}')">
+                <div class="power-icon">⚡</div>
+                <span id="${id}_text">OFF</span>
+            </button>
+        </div>
+        <div class="power-status" id="${id}_status">
+            <span>System Inactive</span>
+        </div>
+    </div>`;
+    }
+
+    if (control.type === CONTROL_SWITCH) {
+        return `
+    <div class="control-card" id="${id}_control">
+        <div class="control-header">
+            <div class="control-info">
+                <h3>${title}</h3>
+                <p>${description}</p>
+            </div>
+            <div class="control-indicator" id="${id}_indicator"></div>
+        </div>
+        <div class="switch-container">
+            <label class="switch">
+                <input type="checkbox" id="${id}_input" onchange="toggleControl('${id}')">
+                <span class="switch-slider"></span>
+            </label>
+            <span class="switch-status" id="${id}_status">OFF</span>
+        </div>
+    </div>`;
+    }
+
+    if (control.type === CONTROL_BUTTON) {
+        return `
+    <div class="control-card" id="${id}_control">
+        <div class="control-header">
+            <h3>${title}</h3>
+            <p>${description}</p>
+        </div>
+        <button class="action-button bg-${escapeHtml(control.color)}" id="${id}" onclick="clickControl('${id}')">
+            Execute
+        </button>
+    </div>`;
+    }
+
+    if (control.type === CONTROL_SLIDER) {
+        return `
+    <div class="control-card" id="${id}_control">
+        <div class="control-header">
+            <h3>${title}</h3>
+            <p>${description}</p>
+        </div>
+        <div class="slider-container">
+            <input type="range" class="slider" id="${id}_input" min="${control.min}" max="${control.max}" value="${control.min}" oninput="slideControl('${id}', this.value)">
+            <div class="slider-value">
+                <span id="${id}_value">${control.min}</span>
+            </div>
+        </div>
+    </div>`;
+    }
+
+    if (control.type === CONTROL_SETPOINT) {
+        const decimals = (String(control.step).split('.')[1] || '').length;
+        return `
+    <div class="control-card" id="${id}_control">
+        <div class="control-header">
+            <h3>${title}</h3>
+            <p>${description}</p>
+        </div>
+        <div class="setpoint-container">
+            <button class="setpoint-step bg-${escapeHtml(control.color)}" onclick="stepSetpoint('${id}', -1)">−</button>
+            <input type="number" class="setpoint-input" id="${id}_input" min="${control.min}" max="${control.max}" step="${control.step || 'any'}" data-decimals="${decimals}" value="${control.min}" onchange="setSetpoint('${id}', this.value)">
+            <button class="setpoint-step bg-${escapeHtml(control.color)}" onclick="stepSetpoint('${id}', 1)">+</button>
+        </div>
+    </div>`;
+    }
+
+    if (control.type === CONTROL_JOYSTICK) {
+        return `
+    <div class="control-card" id="${id}_control">
+        <div class="control-header">
+            <h3>${title}</h3>
+            <p>${description}</p>
+        </div>
+        <div class="joystick-container">
+            <div class="joystick-pad" id="${id}_pad" data-rate="${control.rate}" onpointerdown="startJoystick('${id}', event)">
+                <div class="joystick-knob bg-${escapeHtml(control.color)}" id="${id}_knob"></div>
+            </div>
+            <div class="slider-value">
+                <span id="${id}_value">0.00, 0.00</span>
+            </div>
+        </div>
+    </div>`;
+    }
+
+    return '';
+}
+
+function initWebSocket() {
+    const protocol = window.location.protocol === 'https:' ? 'wss:' : 'ws:';
+    const wsUrl = `${protocol}//${window.location.hostname}:81`;
+
+    debug('Connecting to WebSocket:', wsUrl);
+    ws = new WebSocket(wsUrl);
+
+    ws.onopen = function() {
+        debug('✅ WebSocket connected');
+        reconnectAttempts = 0;
+        clockOffset = null;
+        lastSeq = null;
+        updateConnectionStatus(true);
+    };
+
+    ws.onmessage = function(event) {
+        try {
+            const data = JSON.parse(event.data);
+            updateUI(data);
+        } catch (error) {
+            console.error('❌ Error parsing WebSocket data:', error);
+        }
+    };
+
+    ws.onclose = function() {
+        debug('❌ WebSocket disconnected');
+        updateConnectionStatus(false);
+
+        if (reconnectAttempts < maxReconnectAttempts) {
+            reconnectAttempts++;
+            const delay = Math.min(1000 * Math.pow(2, reconnectAttempts), 30000);
+            debug(`🔄 Reconnecting in ${delay}ms (attempt ${reconnectAttempts}/${maxReconnectAttempts})`);
+            setTimeout(initWebSocket, delay);
+        } else {
+            debug('❌ Max reconnection attempts reached');
+        }
+    };
+
+    ws.onerror = function(error) {
+        console.error('❌ WebSocket error:', error);
+    };
+}
+
+function updateUI(data) {
+    debug('📊 Updating UI with data:', data);
+
+    if (data.layout) {
+        applyLayoutChange(data.layout);
+        return;
+    }
+
+    if (data.capture) {
+        showCapture(data.capture);
+        return;
+    }
+
+    // A layout change was missed while disconnected - fetch it again
+    if (data.layoutVersion !== undefined && data.layoutVersion !== layoutVersion) {
+        if (!layoutLoading) {
+            debug('🔄 Layout changed, reloading layout');
+            loadLayout().then(requestSnapshot);
+        }
+        return;
+    }
+
+    // Updates are deltas, so a missed broadcast leaves stale values behind
+    if (data.seq !== undefined) {
+        if (lastSeq !== null && data.seq > lastSeq + 1) {
+            debug(`⚠️ Missed frames ${lastSeq + 1}..${data.seq - 1}, requesting snapshot`);
+            requestSnapshot();
+        }
+        lastSeq = data.seq;
+    }
+
+    trackClock(data);
+
+    // Update client count
+    if (data.connectedClients !== undefined) {
+        const clientCountEl = document.getElementById('clientCount');
+        if (clientCountEl) {
+            clientCountEl.textContent = data.connectedClients;
+        }
+    }
+
+    // Update cards
+    if (data.cards) {
+        data.cards.forEach(card => {
+            const valueEl = document.getElementById(card.id + '_value');
+            const statusEl = document.getElementById(card.id + '_status');
+
+            if (valueEl) {
+                valueEl.textContent = card.value;
+                debug(`📊 Updated ${card.id} value: ${card.value}`);
+            }
+            if (statusEl && !captures[card.id]) {
+                statusEl.textContent = card.status;
+            }
+
+            // Compressed chart history arrives as a byte block
+            if (card.enc) {
+                const block = decodeChartBlock(card);
+                if (card.type === CARD_CHART) {
+                    card.chartData = block.t.map((timestamp, i) => ({ timestamp: timestamp, value: block.series[0][i] }));
+                } else {
+                    card.series = block.series;
+                    card.t = block.t;
+                }
+            }
+
+            // Update charts
+            if (card.type === CARD_CHART && card.chartData) {
+                updateChart(card.id, card.chartData);
+            }
+            if (card.type === CARD_MULTI_CHART && card.series) {
+                updateMultiChart(card.id, card.series, card.t);
+            }
+        });
+    }
+
+    // Update controls
+    if (data.controls) {
+        data.controls.forEach(control => {
+            updateControlUI(control.id, control.state, control.value);
+        });
+    }
+}
+
+function trackClock(data) {
+    if (data.timestamp === undefined) return;
+
+    // The device switched from uptime to wall-clock time (or rebooted)
+    if (data.synced !== clockSynced) {
+        clockSynced = data.synced;
+        clockOffset = null;
+    }
+
+    const offset = Date.now() - data.timestamp;
+    if (clockOffset === null || offset < clockOffset) {
+        clockOffset = offset;
+        debug(`🕒 Clock offset ${offset} ms (device ${clockSynced ? 'synced' : 'on uptime'})`);
+    }
+}
+
+// Device timestamp -> browser Date; uptime is shifted by the estimated offset
+function deviceTime(timestamp) {
+    return new Date(clockSynced || clockOffset === null ? timestamp : timestamp + clockOffset);
+}
+
+function formatTime(timestamp) {
+    return deviceTime(timestamp).toLocaleTimeString([], { hour12: false });
+}
+
+function applyLayoutChange(change) {
+    debug(`🧩 Layout ${change.op} ${change.kind}: ${change.id}`);
+
+    // Changes must be applied in sequence; after a gap start from a fresh layout
+    if (layoutLoading || change.version !== layoutVersion + 1) {
+        if (!layoutLoading) {
+            loadLayout().then(requestSnapshot);
+        }
+        return;
+    }
+
+    const existing = document.getElementById(change.id + '_' + change.kind);
+    if (change.op === 'remove') {
+        if (existing) {
+            existing.remove();
+        }
+    } else {
+        const html = change.kind === 'card' ? renderCard(change.widget) : renderControl(change.widget);
+        if (existing) {
+            existing.outerHTML = html;
+        } else {
+            const containerId = change.kind === 'card' ? 'cardsContainer' : 'controlsContainer';
+            document.getElementById(containerId).insertAdjacentHTML('beforeend', html);
+        }
+    }
+
+    layoutVersion = change.version;
+}
+
+function updateChart(cardId, chartData) {
+    charts[cardId] = [{ values: chartData.map(point => point.value), color: COLORS.blue }];
+    chartTimes[cardId] = chartData.map(point => point.timestamp);
+
+    // A captured burst stays on screen until the user dismisses it
+    if (captures[cardId]) return;
+
+    drawChart(cardId, charts[cardId], chartTimes[cardId]);
+}
+
+function updateMultiChart(cardId, series, times) {
+    const colors = seriesColors[cardId] || [];
+    charts[cardId] = series.map((values, index) => ({ values: values, color: colors[index] || COLORS.blue }));
+    chartTimes[cardId] = times;
+    drawChart(cardId, charts[cardId], times);
+}
+
+// seriesList: [{ values, color }], all series drawn against one shared scale;
+// times (optional) labels the first and last sample
+function drawChart(cardId, seriesList, times) {
+    const canvas = document.getElementById(cardId + '_chart');
+    if (!canvas) return;
+
+    const ctx = canvas.getContext('2d');
+    const rect = canvas.getBoundingClientRect();
+    canvas.width = rect.width;
+    canvas.height = rect.height;
+
+    // Clear canvas
+    ctx.clearRect(0, 0, canvas.width, canvas.height);
+
+    const length = seriesList.length ? seriesList[0].values.length : 0;
+    if (length < 2) return;
+
+    // Find min/max values; null points are gaps
+    let minValue = Infinity;
+    let maxValue = -Infinity;
+    for (const series of seriesList) {
+        for (const value of series.values) {
+            if (value === null) continue;
+            if (value < minValue) minValue = value;
+            if (value > maxValue) maxValue = value;
+        }
+    }
+    if (minValue === Infinity) return;
+    const range = maxValue - minValue || 1;
+
+    // Set up drawing
+    const padding = 20;
+    const chartWidth = canvas.width - 2 * padding;
+    const chartHeight = canvas.height - 2 * padding;
+    const xOf = index => padding + (chartWidth / (length - 1)) * index;
+    const yOf = value => padding + chartHeight - ((value - minValue) / range) * chartHeight;
+
+    // Draw grid lines
+    ctx.strokeStyle = isDarkMode ? '#334155' : '#e2e8f0';
+    ctx.lineWidth = 1;
+
+    // Horizontal grid lines
+    for (let i = 0; i <= 4; i++) {
+        const y = padding + (chartHeight / 4) * i;
+        ctx.beginPath();
+        ctx.moveTo(padding, y);
+        ctx.lineTo(canvas.width - padding, y);
+        ctx.stroke();
+    }
+
+    if (times && times.length === length) {
+        ctx.fillStyle = isDarkMode ? '#94a3b8' : '#64748b';
+        ctx.font = '10px sans-serif';
+        ctx.textBaseline = 'bottom';
+        ctx.textAlign = 'left';
+        ctx.fillText(formatTime(times[0]), padding, canvas.height);
+        ctx.textAlign = 'right';
+        ctx.fillText(formatTime(times[length - 1]), canvas.width - padding, canvas.height);
+    }
+
+    seriesList.forEach(series => {
+        // Draw chart line
+        ctx.strokeStyle = series.color;
+        ctx.lineWidth = length > 200 ? 1 : 2;
+        ctx.beginPath();
+
+        // The line is broken at gaps
+        let drawing = false;
+        series.values.forEach((value, index) => {
+            if (value === null) {
+                drawing = false;
+            } else if (!drawing) {
+                ctx.moveTo(xOf(index), yOf(value));
+                drawing = true;
+            } else {
+                ctx.lineTo(xOf(index), yOf(value));
+            }
+        });
+
+        ctx.stroke();
+
+        // Draw data points (skipped for dense captures)
+        if (length > 100) return;
+
+        ctx.fillStyle = series.color;
+        series.values.forEach((value, index) => {
+            if (value === null) return;
+            ctx.beginPath();
+            ctx.arc(xOf(index), yOf(value), 3, 0, 2 * Math.PI);
+            ctx.fill();
+        });
+    });
+}
+
+function showCapture(capture) {
+    debug(`⏺ Capture for ${capture.id}: ${capture.count} samples @ ${capture.rate} Hz`);
+
+    const values = decodeQuantizedDeltas(capture.data, capture.count, capture.offset, capture.scale);
+    captures[capture.id] = [{ values: values, color: COLORS.blue }];
+    drawChart(capture.id, captures[capture.id]);
+
+    const statusEl = document.getElementById(capture.id + '_status');
+    if (statusEl) {
+        const duration = (capture.count / capture.rate * 1000).toFixed(1);
+        statusEl.textContent = `⏺ ${capture.count} samples @ ${capture.rate} Hz (${duration} ms)` +
+            (capture.dropped ? `, ${capture.dropped} dropped` : '') + ' - click chart for live view';
+    }
+
+    const canvas = document.getElementById(capture.id + '_chart');
+    if (canvas) {
+        canvas.onclick = () => {
+            delete captures[capture.id];
+            canvas.onclick = null;
+            drawChart(capture.id, charts[capture.id] || [], chartTimes[capture.id]);
+        };
+    }
+}
+
+function base64ToBytes(text) {
+    const binary = atob(text);
+    const bytes = new Uint8Array(binary.length);
+    for (let i = 0; i < binary.length; i++) {
+        bytes[i] = binary.charCodeAt(i);
+    }
+    return bytes;
+}
+
+// Reads LEB128 varints; plain arithmetic keeps values above 2^31 exact
+function varintReader(bytes) {
+    let pos = 0;
+    return () => {
+        let value = 0;
+        let shift = 1;
+        let byte;
+        do {
+            byte = bytes[pos++];
+            value += (byte & 0x7f) * shift;
+            shift *= 128;
+        } while (byte & 0x80);
+        return value;
+    };
+}
+
+function unzigzag(raw) {
+    return raw % 2 ? -(raw + 1) / 2 : raw / 2;
+}
+
+// Mirror of DashboardCodec::appendQuantizedDeltas: zigzag varint step
+// deltas + 1, 0 for a gap (decoded as null)
+function decodeQuantizedDeltas(text, count, offset, scale) {
+    const readVarint = varintReader(base64ToBytes(text));
+    const values = new Array(count);
+    let step = 0;
+
+    for (let i = 0; i < count; i++) {
+        const raw = readVarint();
+        if (raw === 0) {
+            values[i] = null;
+            continue;
+        }
+        step += unzigzag(raw - 1);
+        values[i] = offset + step * scale;
+    }
+
+    return values;
+}
+
+// Mirror of DashboardChartBuffer: every row is encoded against the previous
+// one, starting from the base row [timestamp, column...]. Gaps (failed
+// sensor reads) decode as null.
+function decodeChartBlock(card) {
+    const readVarint = varintReader(base64ToBytes(card.data));
+    const scale = Math.pow(10, card.p);
+    const bits = new DataView(new ArrayBuffer(4));
+    const previous = card.base.slice(1);
+    const times = [];
+    const series = previous.map(() => []);
+    let timestamp = card.base[0];
+
+    for (let row = 0; row < card.rows; row++) {
+        timestamp += readVarint();
+        times.push(timestamp);
+
+        previous.forEach((value, column) => {
+            const raw = readVarint();
+            if (card.enc === CHART_COMPRESSION_XOR) {
+                const xor = (Math.floor(raw / 32) << (raw % 32)) >>> 0;
+                previous[column] = (value ^ xor) >>> 0;
+                bits.setUint32(0, previous[column]);
+                const decoded = bits.getFloat32(0);
+                series[column].push(Number.isFinite(decoded) ? decoded : null);
+            } else if (raw === 0) {
+                series[column].push(null);
+            } else {
+                previous[column] = value + unzigzag(raw - 1);
+                series[column].push(previous[column] / scale);
+            }
+        });
+    }
+
+    return { t: times, series: series };
+}
+
+function updateControlUI(id, state, value) {
+    debug(`🎛️ Updating control ${id}: state=${state}, value=${value}`);
+
+    // Update switches
+    const switchInput = document.getElementById(id + '_input');
+    const indicator = document.getElementById(id + '_indicator');
+    const status = document.getElementById(id + '_status');
+
+    if (switchInput) {
+        switchInput.checked = state;
+    }
+
+    if (indicator) {
+        indicator.classList.toggle('active', state);
+    }
+
+    if (status) {
+        status.textContent = state ? 'ON' : 'OFF';
+    }
+
+    // Update power buttons
+    const powerButton = document.getElementById(id);
+    const powerText = document.getElementById(id + '_text');
+    const powerStatus = document.getElementById(id + '_status');
+
+    if (powerButton && powerButton.classList.contains('power-button')) {
+        powerButton.classList.toggle('active', state);
+        if (powerText) {
+            powerText.textContent = state ? 'ON' : 'OFF';
+        }
+        if (powerStatus) {
+            powerStatus.classList.toggle('active', state);
+            powerStatus.textContent = state ? 'System Active' : 'System Inactive';
+        }
+    }
+
+    // Update sliders
+    const sliderInput = document.getElementById(id + '_input');
+    const sliderValue = document.getElementById(id + '_value');
+
+    if (sliderInput && sliderInput.type === 'range') {
+        sliderInput.value = value;
+    }
+
+    // The device may have clamped or snapped the value; don't fight the user while they type
+    if (sliderInput && sliderInput.type === 'number' && document.activeElement !== sliderInput) {
+        sliderInput.value = Number(value).toFixed(parseInt(sliderInput.dataset.decimals) || 0);
+    }
+
+    // A joystick's span shows the local stick position; frames don't carry x/y
+    const joystickPad = document.getElementById(id + '_pad');
+    if (sliderValue && !joystickPad) {
+        sliderValue.textContent = value;
+    }
+}
+
+function updateConnectionStatus(connected) {
+    const statusEl = document.getElementById('connectionStatus');
+    if (statusEl) {
+        statusEl.className = connected ? 'status-indicator online' : 'status-indicator offline';
+        statusEl.innerHTML = connected ?
+            '<div class="status-dot"></div><span>Online</span>' :
+            '<div class="status-dot"></div><span>Offline</span>';
+    }
+}
+
+// Sends a control action as an 8-byte binary command, or as JSON for a
+// control whose layout carried no handle
+function sendCommand(id, opcode, action, value) {
+    const handle = controlHandles[id];
+    if (handle === undefined) {
+        const message = JSON.stringify({ id: id, action: action, value: value });
+        ws.send(message);
+        debug(`📤 Sent: ${message}`);
+        return;
+    }
+
+    const view = commandFrame(opcode, handle);
+    view.setFloat32(4, value, true);
+    ws.send(view.buffer);
+    debug(`📤 Sent ${action} ${value} to handle ${handle}`);
+}
+
+function commandFrame(opcode, handle) {
+    const view = new DataView(new ArrayBuffer(8));
+    view.setUint8(0, COMMAND_MAGIC);
+    view.setUint8(1, opcode);
+    view.setUint16(2, handle, true);
+    return view;
+}
+
+// A move carries both axes as 16-bit fractions in place of the value
+function sendMove(id, x, y) {
+    if (!ws || ws.readyState !== WebSocket.OPEN) return;
+
+    const handle = controlHandles[id];
+    if (handle === undefined) {
+        ws.send(JSON.stringify({ id: id, action: 'move', x: x, y: y }));
+        return;
+    }
+
+    const view = commandFrame(COMMAND_MOVE, handle);
+    view.setInt16(4, Math.round(x * AXIS_SCALE), true);
+    view.setInt16(6, Math.round(y * AXIS_SCALE), true);
+    ws.send(view.buffer);
+}
+
+// While held, the position goes out on a fixed timer: never faster than the
+// control's rate however fast the pointer moves, and steadily enough that the
+// device's stream timeout does not recentre the stick
+function startJoystick(id, event) {
+    const pad = event.currentTarget;
+    const rate = parseInt(pad.dataset.rate) || 20;
+    const stick = { x: 0, y: 0 };
+    pad.setPointerCapture(event.pointerId);
+
+    const track = e => {
+        const rect = pad.getBoundingClientRect();
+        const radius = rect.width / 2;
+        let x = (e.clientX - rect.left - radius) / radius;
+        let y = (rect.top + radius - e.clientY) / radius;
+        const length = Math.hypot(x, y);
+        if (length > 1) {
+            x /= length;
+            y /= length;
+        }
+        stick.x = x;
+        stick.y = y;
+        showJoystick(id, x, y);
+    };
+
+    const release = () => {
+        clearInterval(stick.timer);
+        pad.removeEventListener('pointermove', track);
+        pad.removeEventListener('pointerup', release);
+        pad.removeEventListener('pointercancel', release);
+        showJoystick(id, 0, 0);
+        sendMove(id, 0, 0);
+        debug(`🕹️ Released joystick ${id}`);
+    };
+
+    pad.addEventListener('pointermove', track);
+    pad.addEventListener('pointerup', release);
+    pad.addEventListener('pointercancel', release);
+    track(event);
+    sendMove(id, stick.x, stick.y);
+    stick.timer = setInterval(() => sendMove(id, stick.x, stick.y), 1000 / rate);
+    debug(`🕹️ Streaming joystick ${id} at ${rate} Hz`);
+}
+
+function showJoystick(id, x, y) {
+    const knob = document.getElementById(id + '_knob');
+    if (knob) {
+        knob.style.left = (50 + x * 50) + '%';
+        knob.style.top = (50 - y * 50) + '%';
+    }
+    const value = document.getElementById(id + '_value');
+    if (value) {
+        value.textContent = x.toFixed(2) + ', ' + y.toFixed(2);
+    }
+}
+
+function toggleControl(id) {
+    debug(`🎛️ Toggling control: ${id}`);
+    if (ws && ws.readyState === WebSocket.OPEN) {
+        sendCommand(id, COMMAND_TOGGLE, 'toggle', 0);
+    } else {
+        console.error('❌ WebSocket not connected');
+    }
+}
+
+function clickControl(id) {
+    debug(`🔘 Clicking control: ${id}`);
+    if (ws && ws.readyState === WebSocket.OPEN) {
+        sendCommand(id, COMMAND_CLICK, 'click', 0);
+    } else {
+        console.error('❌ WebSocket not connected');
+    }
+}
+
+function slideControl(id, value) {
+    debug(`🎚️ Sliding control ${id} to: ${value}`);
+    if (ws && ws.readyState === WebSocket.OPEN) {
+        sendCommand(id, COMMAND_SLIDE, 'slide', parseInt(value));
+    } else {
+        console.error('❌ WebSocket not connected');
+    }
+
+    // Update display immediately for responsiveness
+    const valueSpan = document.getElementById(id + '_value');
+    if (valueSpan) {
+        valueSpan.textContent = value;
+    }
+}
+
+// The device validates and debounces setpoints, so every change is sent as is
+function setSetpoint(id, value) {
+    debug(`🎯 Setting ${id} to: ${value}`);
+    if (ws && ws.readyState === WebSocket.OPEN) {
+        sendCommand(id, COMMAND_SET, 'set', parseFloat(value));
+    } else {
+        console.error('❌ WebSocket not connected');
+    }
+}
+
+function stepSetpoint(id, direction) {
+    const input = document.getElementById(id + '_input');
+    if (!input) return;
+
+    const step = parseFloat(input.step) || 1;
+    const value = Math.min(parseFloat(input.max), Math.max(parseFloat(input.min), parseFloat(input.value) + direction * step));
+    input.value = value.toFixed(parseInt(input.dataset.decimals) || 0);
+    setSetpoint(id, input.value);
+}
+
+function toggleTheme() {
+    isDarkMode = !isDarkMode;
+    document.body.classList.toggle('dark', isDarkMode);
+
+    const themeIcon = document.getElementById('themeIcon');
+    if (themeIcon) {
+        themeIcon.textContent = isDarkMode ? '☀️' : '🌙';
+    }
+
+    localStorage.setItem('darkMode', isDarkMode);
+    debug(`🎨 Theme changed to: ${isDarkMode ? 'dark' : 'light'}`);
+
+    // Redraw charts with new theme
+    Object.keys(charts).forEach(chartId => {
+        if (captures[chartId]) {
+            drawChart(chartId, captures[chartId]);
+        } else {
+            drawChart(chartId, charts[chartId], chartTimes[chartId]);
+        }
+    });
+}
+
+function loadTheme() {
+    const savedTheme = localStorage.getItem('darkMode');
+    if (savedTheme === 'true') {
+        toggleTheme();
+    }
+}
+
+// Add some visual feedback for button clicks
+document.addEventListener('click', function(e) {
+    if (e.target.classList.contains('action-button') ||
+        e.target.classList.contains('power-button')) {
+        e.target.style.transform = 'scale(0.95)';
+        setTimeout(() => {
+            e.target.style.transform = '';
+        }, 150);
+    }
+});
+
+// Handle page visibility changes
+document.addEventListener('visibilitychange', function() {
+    if (document.hidden) {
+        debug('📱 Page hidden - reducing update frequency');
+    } else {
+        debug('📱 Page visible - resuming normal updates');
+        if (ws && ws.readyState !== WebSocket.OPEN) {
+            debug('🔄 Reconnecting WebSocket...');
+            initWebSocket();
+        }
+    }
+});
+
+debug('🚀 Dashboard JavaScript initialized');
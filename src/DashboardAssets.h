@@ -0,0 +1,1018 @@
+// Generated by extras/build_web.py from extras/web/ - do not edit by hand.
+#ifndef DASHBOARD_ASSETS_H
+#define DASHBOARD_ASSETS_H
+
+#include <Arduino.h>
+
+#define DASHBOARD_APP_CSS_VERSION "c279f46b"
+const uint8_t DASHBOARD_APP_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5a, 0xdd, 0x8f, 0xa3, 0x38,
+    0x12, 0xff, 0x57, 0xd0, 0xae, 0x46, 0x1b, 0x76, 0x43, 0x04, 0x21, 0xe9, 0x74, 0xc3, 0xcb, 0xea,
+    0x4e, 0x3a, 0xe9, 0x1e, 0xee, 0xe5, 0x56, 0x2b, 0xdd, 0x3d, 0x1a, 0x30, 0x09, 0x1b, 0x82, 0x91,
+    0x6d, 0x3a, 0x9d, 0x89, 0xf2, 0xbf, 0x5f, 0xf9, 0x03, 0xb0, 0x81, 0xd0, 0x49, 0x6b, 0x57, 0xba,
+    0x8c, 0x26, 0x13, 0x8a, 0x72, 0xb9, 0xfc, 0xab, 0x4f, 0xdb, 0xf3, 0xf3, 0xf5, 0x84, 0xe8, 0xbe,
+    0xa8, 0x22, 0x3f, 0xae, 0x51, 0x96, 0x15, 0xd5, 0x1e, 0x7e, 0x25, 0xe4, 0xc3, 0x63, 0xc5, 0x77,
+    0xf1, 0x90, 0x10, 0x9a, 0x61, 0xea, 0x01, 0xe5, 0x16, 0x51, 0x42, 0xf8, 0xd5, 0xf3, 0x6a, 0x5a,
+    0xc0, 0x98, 0x8b, 0x97, 0x92, 0x92, 0xd0, 0xe8, 0xc7, 0x30, 0x79, 0x5d, 0xe7, 0x2f, 0xb1, 0xe7,
+    0x31, 0x9c, 0x92, 0x2a, 0x33, 0xde, 0xbc, 0x6c, 0x76, 0x9b, 0xd7, 0x44, 0xbc, 0x69, 0xd2, 0x14,
+    0x33, 0xd6, 0xd2, 0xd7, 0xeb, 0x74, 0xbb, 0xc5, 0x40, 0x3f, 0x23, 0x5a, 0xc1, 0x24, 0x2d, 0x3d,
+    0xdf, 0xbe, 0x61, 0x5f, 0xf0, 0x67, 0xa8, 0xda, 0xc3, 0xa4, 0x9a, 0x8c, 0xf3, 0x0d, 0x7c, 0x80,
+    0x5c, 0x54, 0x39, 0x69, 0x89, 0xfe, 0x4b, 0xf2, 0x92, 0x09, 0x62, 0xdd, 0xd0, 0xba, 0xc4, 0x2d,
+    0x19, 0xbd, 0x6e, 0xb7, 0xf9, 0x0e, 0xc8, 0x84, 0x0a, 0x19, 0x9d, 0xe4, 0xb7, 0x5d, 0x18, 0x08,
+    0x1d, 0x93, 0x7d, 0xab, 0x3e, 0x10, 0xe5, 0x47, 0x11, 0x3b, 0xdd, 0x81, 0xfc, 0x9a, 0xa3, 0x3c,
+    0x55, 0x64, 0x8e, 0x29, 0x2f, 0x14, 0x35, 0xc8, 0xb7, 0xf9, 0x1b, 0x50, 0x39, 0xfe, 0xe0, 0xbd,
+    0x0c, 0x3f, 0x0f, 0x76, 0x6b, 0xd4, 0x92, 0x0d, 0x29, 0xdd, 0xda, 0x35, 0x80, 0xed, 0x5a, 0xd6,
+    0xf8, 0x35, 0xf7, 0x05, 0x24, 0x07, 0x94, 0x91, 0x73, 0xe4, 0x3b, 0x9b, 0xfa, 0xc3, 0x79, 0x81,
+    0xbf, 0x5e, 0x00, 0x5f, 0x74, 0x9f, 0xa0, 0x85, 0xbf, 0x94, 0x7f, 0x56, 0x81, 0xdb, 0xf1, 0x79,
+    0x25, 0x98, 0xc5, 0x09, 0x7c, 0x60, 0x09, 0xb6, 0x82, 0x39, 0x1c, 0x33, 0xdf, 0x12, 0x92, 0x5d,
+    0xae, 0x39, 0xa9, 0xb8, 0x97, 0xa3, 0x53, 0x51, 0x5e, 0x22, 0x0f, 0xd5, 0x02, 0x1a, 0x76, 0x61,
+    0x1c, 0x9f, 0x96, 0x7f, 0x2b, 0x8b, 0xea, 0xf8, 0x2f, 0x94, 0xfe, 0x26, 0x1f, 0xff, 0x01, 0x7c,
+    0xcb, 0x9f, 0x7e, 0xc3, 0x7b, 0x82, 0x9d, 0xdf, 0xff, 0xf9, 0xd3, 0xf2, 0xdf, 0x24, 0x21, 0x9c,
+    0x2c, 0x19, 0xaa, 0x18, 0x2c, 0x83, 0x16, 0x79, 0x9c, 0xa0, 0xf4, 0xb8, 0xa7, 0xa4, 0xa9, 0xb2,
+    0x08, 0x46, 0x62, 0x44, 0xbd, 0x3d, 0x45, 0x59, 0x81, 0x2b, 0xbe, 0x08, 0xc2, 0x6d, 0x86, 0xf7,
+    0xcb, 0x77, 0x44, 0x17, 0x36, 0x7a, 0xae, 0xe3, 0x7f, 0xeb, 0xc9, 0x2d, 0x7a, 0x2e, 0x68, 0xee,
+    0x7f, 0x73, 0x63, 0x85, 0x81, 0x7a, 0x6d, 0xc2, 0xe8, 0xc6, 0xa7, 0xa2, 0xf2, 0x0e, 0xb8, 0xd8,
+    0x1f, 0x78, 0x04, 0xac, 0xef, 0x87, 0x98, 0x83, 0xf9, 0x58, 0xc1, 0x0b, 0x52, 0x45, 0xa8, 0x2c,
+    0x1d, 0x7f, 0x15, 0x32, 0x07, 0x23, 0x86, 0xe5, 0x22, 0x57, 0x30, 0xd5, 0xf1, 0x6a, 0x1b, 0x33,
+    0xc0, 0xeb, 0xb7, 0x30, 0x19, 0x19, 0xb3, 0xb3, 0x8f, 0x65, 0xcc, 0x30, 0xdc, 0x04, 0xdb, 0xed,
+    0xc8, 0x98, 0x9d, 0xe5, 0x87, 0xc6, 0x7c, 0xdb, 0x20, 0xf0, 0xf2, 0x91, 0x31, 0x95, 0x98, 0x1b,
+    0xa8, 0xc3, 0x0e, 0x09, 0x41, 0x34, 0x83, 0x17, 0x15, 0x47, 0x00, 0x16, 0x85, 0xa8, 0xfa, 0xf0,
+    0xce, 0x45, 0xc6, 0x0f, 0x51, 0xb0, 0xf1, 0xc1, 0x6e, 0x71, 0x1b, 0x66, 0x0e, 0x6a, 0x38, 0xe9,
+    0x63, 0xcd, 0x09, 0x28, 0x3e, 0x99, 0x22, 0x0e, 0x18, 0xc1, 0x14, 0x57, 0x03, 0xfd, 0x0e, 0xcf,
+    0x0e, 0xae, 0x2e, 0x28, 0x39, 0x27, 0xa7, 0x48, 0x38, 0x0e, 0x23, 0x65, 0x91, 0x39, 0x9a, 0xd3,
+    0x50, 0xd2, 0xed, 0x66, 0x12, 0xf3, 0x38, 0xbe, 0x56, 0xa3, 0x1d, 0xba, 0x06, 0xa2, 0x8a, 0x76,
+    0xe5, 0x8e, 0x4a, 0x80, 0x7a, 0x80, 0xa1, 0x44, 0x9b, 0x80, 0xf1, 0x22, 0x3d, 0x5e, 0x62, 0x4e,
+    0x6a, 0x48, 0x0e, 0xdf, 0x21, 0x0e, 0x33, 0xfc, 0x21, 0x0c, 0x25, 0x7d, 0x24, 0xa3, 0xa4, 0xf6,
+    0xf2, 0xa2, 0x04, 0x78, 0xa3, 0xa4, 0x6c, 0xe8, 0x42, 0xb8, 0xa9, 0x7b, 0x5b, 0xa9, 0x85, 0x48,
+    0x48, 0xc0, 0x67, 0xae, 0x59, 0xc1, 0xea, 0x12, 0x5d, 0xa2, 0xbc, 0xc4, 0x1f, 0xf1, 0x1f, 0x0d,
+    0x88, 0xcc, 0x2f, 0xed, 0xcb, 0x88, 0xd5, 0x28, 0xc5, 0x5e, 0x82, 0xf9, 0x19, 0xe3, 0x2a, 0x46,
+    0x65, 0xb1, 0xaf, 0xbc, 0x02, 0xbc, 0x94, 0x45, 0x29, 0xbc, 0xc6, 0x34, 0x16, 0xa3, 0xbc, 0x33,
+    0x45, 0x75, 0x24, 0xbe, 0xe2, 0x3d, 0xfc, 0x50, 0xc0, 0x95, 0x64, 0x4f, 0x84, 0xa9, 0x84, 0x9e,
+    0xf6, 0x1c, 0x13, 0x52, 0x06, 0xc3, 0x0a, 0x98, 0xfe, 0xaa, 0x8c, 0x14, 0x0a, 0x20, 0xb4, 0x07,
+    0xca, 0xdf, 0x8f, 0x7a, 0xbf, 0x95, 0x0c, 0x5d, 0x4d, 0xec, 0x13, 0x95, 0xdb, 0x19, 0x4b, 0x8c,
+    0x6e, 0x58, 0xe4, 0xaf, 0x76, 0x5b, 0x21, 0xff, 0x33, 0x55, 0x87, 0x08, 0xb5, 0x38, 0x88, 0xf0,
+    0x86, 0xd4, 0x8c, 0xa3, 0x60, 0x25, 0xe5, 0x28, 0x57, 0x3c, 0x1f, 0x60, 0xf0, 0x5d, 0x43, 0xea,
+    0xe5, 0x0a, 0xaf, 0x76, 0x0e, 0xc1, 0x75, 0x24, 0x43, 0x12, 0xce, 0x6a, 0xf1, 0x3b, 0x7f, 0xe8,
+    0x23, 0xfe, 0x6a, 0xbd, 0xed, 0x31, 0x93, 0x42, 0xea, 0xeb, 0x28, 0x94, 0xfb, 0x14, 0x60, 0xe8,
+    0xe8, 0xaf, 0x5e, 0x77, 0x6a, 0xac, 0xe1, 0x0c, 0x94, 0x94, 0xec, 0x09, 0x4b, 0x31, 0x8e, 0x78,
+    0xc3, 0x84, 0xcf, 0x15, 0x29, 0xe2, 0x84, 0x3e, 0x34, 0xd4, 0x57, 0x0b, 0xeb, 0xa2, 0x4c, 0x3e,
+    0xca, 0x50, 0x1b, 0x98, 0xe3, 0x0d, 0x3e, 0x10, 0x9c, 0x63, 0x95, 0x2d, 0x50, 0xb6, 0x00, 0xca,
+    0xdd, 0x8c, 0x34, 0xd2, 0x70, 0x45, 0x2a, 0xe1, 0x32, 0xe3, 0x10, 0xb6, 0xca, 0xa0, 0x6b, 0x9a,
+    0x6e, 0x4a, 0x48, 0x9e, 0x4f, 0x4b, 0x31, 0x8b, 0xe3, 0xb4, 0x90, 0x0c, 0xca, 0xb4, 0x72, 0x6b,
+    0x8d, 0x83, 0x76, 0x6c, 0xfd, 0x64, 0x23, 0xb0, 0xf5, 0xbf, 0x99, 0xce, 0x9e, 0x36, 0x94, 0x02,
+    0x8e, 0x7f, 0x17, 0x62, 0x63, 0x54, 0x81, 0x73, 0xcb, 0x25, 0xd7, 0x4d, 0xc9, 0xb0, 0xb3, 0x66,
+    0x0e, 0xb8, 0x76, 0x51, 0xc9, 0xc9, 0xd2, 0x52, 0x44, 0x03, 0xe8, 0xd1, 0x08, 0xd8, 0xc7, 0x7a,
+    0x1a, 0x41, 0x60, 0x79, 0xe9, 0x9f, 0x68, 0x94, 0xdb, 0x8a, 0x1f, 0xf0, 0x09, 0x7b, 0x9c, 0xec,
+    0xf7, 0x25, 0xd6, 0x6b, 0x5e, 0x5b, 0x6b, 0x5e, 0x9b, 0x6b, 0x8e, 0x2a, 0x52, 0xe1, 0x78, 0x2a,
+    0xb5, 0x76, 0xa5, 0x6a, 0x02, 0x1d, 0x80, 0x84, 0x81, 0xf6, 0x35, 0x29, 0x46, 0x21, 0x28, 0x23,
+    0xe3, 0xae, 0x6b, 0x7c, 0x31, 0xc8, 0xed, 0x55, 0x45, 0x07, 0xf2, 0x3e, 0x59, 0x0f, 0xac, 0x2c,
+    0x2f, 0x55, 0xc8, 0x09, 0x3d, 0x45, 0x2c, 0x45, 0x25, 0x5e, 0x04, 0xa2, 0x21, 0x30, 0xaa, 0xca,
+    0x09, 0xaa, 0xd2, 0x55, 0x23, 0x6f, 0x26, 0x7f, 0x30, 0x23, 0xbc, 0x66, 0x90, 0xdc, 0x8a, 0xac,
+    0x8b, 0x2c, 0xf1, 0x10, 0x8b, 0x2f, 0x80, 0xe5, 0x04, 0x14, 0x2e, 0xfb, 0xa8, 0xe6, 0x54, 0xb1,
+    0x88, 0xe2, 0x1a, 0x23, 0xbe, 0x10, 0x35, 0x0c, 0x72, 0x3e, 0x5f, 0x42, 0xe1, 0x86, 0x4a, 0xb7,
+    0x08, 0x45, 0x89, 0x5b, 0x06, 0xb9, 0xc8, 0x77, 0x32, 0x74, 0x15, 0xea, 0x76, 0x22, 0x09, 0x07,
+    0x95, 0x4e, 0xcc, 0xfc, 0x48, 0x9d, 0xfb, 0xa4, 0xc0, 0xd9, 0x06, 0x0b, 0xcc, 0xb8, 0x0f, 0x5a,
+    0xe3, 0xdf, 0x29, 0x70, 0x77, 0x0d, 0xd7, 0x55, 0x3e, 0x8a, 0x61, 0xf9, 0xc5, 0x3b, 0x8e, 0x85,
+    0x11, 0xf2, 0x12, 0x24, 0x1c, 0x8a, 0x2c, 0xc3, 0xd5, 0x70, 0x1d, 0xda, 0x4a, 0xbd, 0x19, 0xe4,
+    0x2f, 0x01, 0xdd, 0x7f, 0x17, 0x1e, 0xb4, 0x78, 0xee, 0x3d, 0x25, 0xa0, 0xb3, 0x73, 0x95, 0x11,
+    0xda, 0xca, 0xff, 0x68, 0x6a, 0x1c, 0xa0, 0x1b, 0x74, 0xd6, 0x54, 0x75, 0xad, 0x77, 0x53, 0x59,
+    0xe4, 0xef, 0x94, 0xb9, 0x2f, 0x96, 0xa1, 0x67, 0x42, 0x48, 0x57, 0xbc, 0x56, 0x37, 0xc8, 0x0a,
+    0xce, 0x21, 0xb4, 0x8a, 0x50, 0xb0, 0x1e, 0x05, 0xf7, 0xcb, 0xfd, 0x32, 0xd4, 0x8b, 0x79, 0xbe,
+    0x0c, 0xa5, 0x6d, 0x93, 0x26, 0x3a, 0x12, 0x39, 0x40, 0xae, 0xb9, 0x0b, 0x3c, 0xf9, 0xfe, 0x1d,
+    0x95, 0x0d, 0x36, 0xf1, 0x7b, 0xac, 0x4a, 0x5a, 0x65, 0x3d, 0x29, 0x49, 0x7a, 0xd4, 0xf2, 0x54,
+    0x56, 0x7e, 0x5e, 0xd7, 0x03, 0xa2, 0x5c, 0x05, 0x89, 0x8c, 0x45, 0x15, 0x82, 0xa2, 0x55, 0xaa,
+    0x9c, 0x75, 0xf7, 0xba, 0x6b, 0x38, 0xdb, 0x7c, 0x67, 0x36, 0x9b, 0xba, 0xe7, 0x1b, 0x79, 0x73,
+    0x2f, 0xbc, 0x7a, 0x47, 0x4c, 0xe7, 0x4d, 0xd1, 0xa3, 0xc7, 0x7d, 0x13, 0xfe, 0xad, 0x65, 0x2a,
+    0xf1, 0x1e, 0x57, 0x99, 0xed, 0x96, 0x77, 0xda, 0xb1, 0xa9, 0x94, 0x3d, 0xb3, 0x6c, 0x68, 0x29,
+    0xa4, 0x6c, 0xe9, 0x72, 0x0f, 0xd6, 0xf5, 0x50, 0xa3, 0xa3, 0x47, 0xb2, 0x33, 0xe2, 0xe9, 0xa1,
+    0xab, 0x76, 0x3b, 0xbb, 0xdc, 0xed, 0x26, 0xea, 0x9d, 0xed, 0x47, 0x39, 0x6c, 0x69, 0x87, 0x31,
+    0xf7, 0x74, 0x73, 0xaa, 0x3d, 0x41, 0xb4, 0xc7, 0x66, 0xfa, 0xe9, 0x09, 0x5a, 0x03, 0xf9, 0x3c,
+    0x97, 0xcb, 0xa0, 0x82, 0xab, 0x4e, 0xd6, 0xe3, 0x05, 0x2f, 0xf1, 0xb3, 0x9d, 0x9a, 0xd5, 0x12,
+    0x4e, 0x6c, 0xb3, 0x60, 0xcd, 0xba, 0xff, 0xfa, 0x6b, 0xf2, 0x7d, 0x27, 0xff, 0xff, 0x38, 0xb5,
+    0xdb, 0x3a, 0xce, 0xa6, 0xed, 0xf5, 0xe7, 0x69, 0x5b, 0x8b, 0x9a, 0xca, 0xdc, 0x8f, 0x7b, 0x91,
+    0x0c, 0x26, 0x48, 0x12, 0x94, 0x4f, 0xa7, 0x74, 0x3d, 0xc9, 0x9f, 0x90, 0x39, 0x4d, 0x49, 0x5f,
+    0x48, 0x9e, 0xdd, 0xf0, 0xb6, 0x15, 0x7f, 0x22, 0xec, 0x06, 0x6d, 0xe6, 0xf4, 0xac, 0x9f, 0x1b,
+    0xad, 0xef, 0x8f, 0x51, 0x2a, 0x32, 0xd9, 0xa7, 0x4d, 0xf6, 0x6c, 0x0b, 0xcb, 0xce, 0x05, 0x64,
+    0x0f, 0x23, 0x89, 0x3e, 0x5b, 0x0e, 0x2d, 0xa3, 0xb6, 0xf2, 0xae, 0xe3, 0xee, 0xa1, 0x95, 0x5b,
+    0xc8, 0x9d, 0x81, 0x27, 0xab, 0x43, 0x5b, 0x92, 0xed, 0x76, 0x55, 0xed, 0x79, 0xa4, 0x1c, 0x50,
+    0xb4, 0x6e, 0xf8, 0x95, 0xc0, 0x1c, 0x05, 0xbf, 0xc0, 0xce, 0x5b, 0xc3, 0xdd, 0x01, 0xdd, 0x2d,
+    0x80, 0x41, 0x00, 0x81, 0xf6, 0xdd, 0xbc, 0x28, 0x81, 0x98, 0x6a, 0xa0, 0xd7, 0x1e, 0xb4, 0xae,
+    0x6a, 0x03, 0x5f, 0xe2, 0x1c, 0x06, 0xc7, 0x54, 0x09, 0x89, 0x5b, 0x2f, 0x31, 0xcc, 0xe3, 0xcd,
+    0xb9, 0x86, 0x61, 0x24, 0x61, 0xa0, 0x81, 0x9d, 0xcd, 0x05, 0x68, 0xbd, 0xa2, 0x04, 0x43, 0x6c,
+    0xe1, 0x29, 0xf5, 0x34, 0x8c, 0x3f, 0xfc, 0xd0, 0x15, 0x1e, 0x85, 0x86, 0xae, 0x48, 0xea, 0x41,
+    0xe9, 0xab, 0x7b, 0x6d, 0xdb, 0xa7, 0xc7, 0x3a, 0xab, 0x3d, 0xc6, 0xbc, 0x8e, 0xd2, 0x17, 0xfb,
+    0xb8, 0xf6, 0x1d, 0x88, 0x74, 0x79, 0x0e, 0x67, 0x9d, 0xa8, 0xad, 0x5d, 0xdb, 0x10, 0x51, 0x7a,
+    0xc0, 0xe9, 0x11, 0x67, 0xce, 0x2f, 0xce, 0x00, 0xf7, 0x3b, 0xc0, 0xd9, 0x9e, 0xf8, 0xa0, 0xb0,
+    0x16, 0xac, 0x89, 0x94, 0xf4, 0x9f, 0x85, 0x02, 0xc4, 0xed, 0xf1, 0x55, 0x9d, 0xc5, 0x70, 0xab,
+    0x3a, 0x5b, 0x72, 0x6b, 0x72, 0xee, 0x37, 0xe2, 0x53, 0x3d, 0x90, 0x62, 0x48, 0x1a, 0xc0, 0xb9,
+    0xb2, 0x0e, 0xb4, 0x54, 0x4b, 0xa1, 0x76, 0x6d, 0xbe, 0xcd, 0xa7, 0x33, 0x81, 0xe9, 0xc9, 0xf7,
+    0x72, 0x80, 0xca, 0xfb, 0xe1, 0x20, 0xef, 0x0f, 0x9d, 0xec, 0x89, 0xc3, 0xc7, 0xae, 0xef, 0x9c,
+    0x3a, 0x8f, 0x74, 0x47, 0x21, 0xf0, 0xd0, 0x5e, 0x4d, 0xa6, 0xe4, 0xac, 0xa0, 0xaa, 0x1a, 0x47,
+    0xaa, 0x1a, 0x3e, 0x7b, 0x4c, 0x63, 0x24, 0xe4, 0x99, 0x92, 0x6c, 0xc2, 0x38, 0x2a, 0x47, 0xed,
+    0x66, 0xce, 0xdf, 0x0e, 0x38, 0xbb, 0xf4, 0x67, 0x1e, 0x48, 0x4e, 0x26, 0xc0, 0x47, 0x91, 0xb4,
+    0x87, 0x2d, 0x7f, 0x0c, 0x5e, 0x50, 0xb8, 0x41, 0xee, 0xbd, 0x03, 0x26, 0xdf, 0x81, 0xb0, 0xf1,
+    0xdb, 0x98, 0x09, 0x37, 0xcb, 0xe0, 0x6d, 0xb7, 0x7c, 0xdb, 0x40, 0xdc, 0x84, 0x9d, 0xaa, 0x83,
+    0x7d, 0xc8, 0xe4, 0xa6, 0xb0, 0x2b, 0x4e, 0x6a, 0xc8, 0x17, 0x7b, 0x65, 0x73, 0x70, 0x0b, 0xcd,
+    0x5c, 0x28, 0x22, 0xd5, 0x65, 0x59, 0xce, 0x2b, 0xfb, 0xdf, 0xfe, 0x70, 0x62, 0xa7, 0x4e, 0x27,
+    0x26, 0x8e, 0x0f, 0x06, 0xed, 0xe4, 0x64, 0x05, 0x7e, 0xd4, 0xeb, 0xac, 0xe3, 0x1b, 0x4b, 0xab,
+    0xd9, 0xd6, 0x24, 0x98, 0x69, 0x4d, 0x44, 0x7a, 0x90, 0xa9, 0xe4, 0x5e, 0x5d, 0x9b, 0x76, 0x6e,
+    0xe3, 0xc4, 0x4d, 0x65, 0xb5, 0xf1, 0xae, 0x60, 0xf2, 0xfc, 0x68, 0x9c, 0x89, 0xa7, 0xb6, 0x84,
+    0xa4, 0xe1, 0xc2, 0xfb, 0x14, 0x82, 0x00, 0x54, 0x72, 0x2c, 0xb8, 0xb8, 0x9e, 0x00, 0x7f, 0x44,
+    0x55, 0xaa, 0xe9, 0x33, 0x47, 0x6c, 0x2a, 0x37, 0x46, 0xed, 0x48, 0xbd, 0x40, 0x7e, 0x68, 0x4e,
+    0xc9, 0x75, 0x28, 0xc6, 0x2a, 0x1e, 0x76, 0x5d, 0x79, 0xa0, 0x27, 0xb1, 0x0f, 0x74, 0x87, 0x86,
+    0xfc, 0x42, 0xbf, 0x39, 0xa7, 0xfb, 0xdd, 0x80, 0x0f, 0x5c, 0x63, 0xe0, 0x89, 0x7c, 0xf7, 0xd4,
+    0x75, 0x96, 0x5a, 0xf0, 0x5f, 0xbb, 0x40, 0xd3, 0xd3, 0x3f, 0x71, 0x30, 0xb5, 0x53, 0x1e, 0xd5,
+    0x90, 0x51, 0x34, 0x4c, 0xb4, 0xac, 0x66, 0x74, 0xda, 0x1a, 0xdd, 0x56, 0x7f, 0x90, 0x8b, 0xbc,
+    0x71, 0x78, 0xce, 0x81, 0x67, 0x4f, 0x91, 0x3b, 0x91, 0x10, 0xe0, 0x13, 0xfd, 0x59, 0xeb, 0xeb,
+    0x26, 0xa0, 0xfe, 0x83, 0x78, 0x5a, 0x7e, 0xae, 0xd1, 0x84, 0x14, 0x9b, 0x40, 0xb7, 0xd5, 0x40,
+    0x8d, 0x56, 0x41, 0xad, 0x00, 0x6d, 0x98, 0xc8, 0x52, 0xb8, 0x04, 0xc5, 0x25, 0xc1, 0xd0, 0xeb,
+    0x58, 0x91, 0x64, 0xa2, 0x43, 0x92, 0xbd, 0x8f, 0x98, 0x56, 0xb4, 0x6e, 0xe2, 0xdf, 0x7b, 0xd7,
+    0x15, 0x23, 0x3d, 0x27, 0x12, 0xc7, 0xc2, 0x83, 0x17, 0x4b, 0xf1, 0xe5, 0xce, 0x5d, 0xfa, 0x48,
+    0x47, 0xf0, 0xf0, 0x3b, 0x60, 0xc8, 0xb4, 0x9a, 0x0c, 0x73, 0x49, 0x7f, 0xa2, 0x55, 0xee, 0x8f,
+    0xe1, 0x8d, 0xe1, 0xaa, 0xa3, 0x15, 0x43, 0xa2, 0x40, 0x5e, 0xfa, 0xb5, 0x2d, 0xad, 0x7d, 0x28,
+    0xfc, 0x95, 0xdd, 0x61, 0x3b, 0x72, 0xde, 0x3c, 0x77, 0x6f, 0x20, 0x1f, 0xd8, 0x55, 0x4d, 0xf4,
+    0x4a, 0xdd, 0xc2, 0x18, 0xc7, 0xf5, 0xc3, 0xe7, 0xcf, 0x53, 0x7a, 0x9b, 0x65, 0x76, 0x7c, 0xc2,
+    0x6c, 0x07, 0xe9, 0x6d, 0x25, 0x55, 0x49, 0x44, 0xf0, 0xcd, 0xc5, 0x91, 0xe4, 0xda, 0x53, 0xd8,
+    0x9a, 0xcc, 0x16, 0x43, 0xc9, 0xa6, 0xee, 0xcb, 0x2d, 0x3e, 0xf3, 0x0a, 0xbd, 0x65, 0xa3, 0x38,
+    0xb3, 0x78, 0xac, 0xcb, 0x08, 0xcd, 0xa3, 0x6e, 0xe4, 0x6d, 0xcd, 0x8c, 0x4b, 0xfa, 0x96, 0x2d,
+    0xbd, 0x20, 0x5b, 0x2f, 0xe3, 0xc2, 0x40, 0xb3, 0x5c, 0x70, 0x59, 0x92, 0xb3, 0xc5, 0x64, 0xfd,
+    0x97, 0x01, 0xe0, 0x03, 0xf3, 0x4a, 0x1c, 0x3e, 0x49, 0x73, 0x92, 0x51, 0x41, 0xf1, 0xc9, 0x8e,
+    0x51, 0x72, 0x6a, 0x34, 0x46, 0xac, 0x03, 0x48, 0x80, 0x53, 0x00, 0x32, 0x7f, 0x45, 0x23, 0xd9,
+    0x34, 0x26, 0x63, 0x2d, 0x6d, 0x60, 0x80, 0x53, 0xc2, 0x32, 0x77, 0x99, 0x22, 0xb9, 0x34, 0x32,
+    0x23, 0xbe, 0x01, 0x3c, 0xbf, 0x1e, 0xf1, 0x25, 0xa7, 0xe8, 0x84, 0x99, 0x23, 0xb7, 0xbf, 0x57,
+    0x88, 0x7f, 0x51, 0xd1, 0xbb, 0x4d, 0x65, 0x70, 0xdb, 0x1a, 0x4f, 0xe0, 0x8b, 0xb7, 0xdb, 0xaf,
+    0x27, 0x9c, 0x15, 0xc8, 0x59, 0xf4, 0x37, 0xd8, 0xbb, 0x97, 0x57, 0xe8, 0x37, 0xae, 0x93, 0xf7,
+    0xdc, 0xfd, 0x45, 0x76, 0x1b, 0xec, 0xc6, 0x85, 0xc2, 0xf4, 0x99, 0x52, 0x90, 0xd3, 0xf9, 0xd3,
+    0xcd, 0x60, 0x78, 0x50, 0x35, 0x27, 0x67, 0xf2, 0xc4, 0xd6, 0x68, 0x0a, 0xad, 0x1e, 0x6f, 0x63,
+    0x44, 0xa6, 0xf8, 0x7d, 0xbb, 0xfd, 0x0f, 0xcc, 0xb5, 0x25, 0x9e, 0x00, 0x23, 0x00, 0x00
+};
+const size_t DASHBOARD_APP_CSS_GZ_LEN = 2223;
+
+#define DASHBOARD_APP_JS_VERSION "71e14f91"
+const uint8_t DASHBOARD_APP_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3c, 0xdb, 0x72, 0xdb, 0xc8,
+    0x72, 0xef, 0xfa, 0x0a, 0x58, 0xeb, 0x35, 0xc0, 0x15, 0x45, 0x51, 0x92, 0x65, 0x7b, 0x75, 0xdb,
+    0xc8, 0xb2, 0xbc, 0xe6, 0xc6, 0xb6, 0x1c, 0x4b, 0x7b, 0x39, 0xa5, 0x72, 0x6c, 0x90, 0x18, 0x8a,
+    0x58, 0x83, 0x00, 0x17, 0x00, 0x25, 0x72, 0x75, 0x58, 0x75, 0x1e, 0xcf, 0xc3, 0xa9, 0x3a, 0x55,
+    0x79, 0x4a, 0x52, 0x95, 0x4a, 0xe5, 0x2f, 0x52, 0xf9, 0x9c, 0xfd, 0x81, 0xe4, 0x13, 0xd2, 0x97,
+    0xb9, 0x82, 0x20, 0x2d, 0x7b, 0xf7, 0x9c, 0x5a, 0x3f, 0x58, 0xc0, 0x4c, 0x77, 0x4f, 0x4f, 0x4f,
+    0x4f, 0x4f, 0x4f, 0x77, 0x83, 0x89, 0x28, 0xbd, 0xeb, 0x62, 0x6f, 0x25, 0x81, 0xbf, 0x71, 0xf1,
+    0x24, 0xcc, 0xdf, 0xbf, 0xc8, 0x22, 0xe1, 0x1d, 0x78, 0xfd, 0x30, 0x29, 0x04, 0xb7, 0xe7, 0xa2,
+    0x97, 0xa5, 0xa9, 0xe8, 0x95, 0x47, 0x65, 0x29, 0x86, 0xa3, 0xb2, 0x80, 0xee, 0xf6, 0xde, 0x0a,
+    0x34, 0x16, 0xa5, 0x37, 0x0c, 0x27, 0xaf, 0x6b, 0xfa, 0x77, 0x54, 0x7f, 0x6f, 0x10, 0xe6, 0xd4,
+    0x72, 0x33, 0x73, 0x9a, 0xce, 0xe3, 0xa1, 0xa8, 0x34, 0x87, 0xa3, 0x72, 0x9c, 0x57, 0x1a, 0x0b,
+    0x91, 0xc7, 0xa2, 0x38, 0xce, 0x92, 0x2c, 0x77, 0x3b, 0x8e, 0x4f, 0x9f, 0x9f, 0xbe, 0x3e, 0xc3,
+    0xa6, 0x95, 0x6e, 0x32, 0x16, 0xbb, 0x9e, 0xff, 0xd9, 0x76, 0xf7, 0xd1, 0x56, 0xff, 0x81, 0xdf,
+    0xf4, 0x2e, 0x73, 0x21, 0x52, 0x6c, 0xd9, 0xda, 0xea, 0xed, 0xec, 0x08, 0x68, 0xc9, 0xf2, 0x30,
+    0xbd, 0x24, 0xa0, 0xfe, 0x97, 0x0f, 0xb7, 0x37, 0x11, 0x28, 0x17, 0x11, 0xbe, 0x8b, 0xfe, 0x7d,
+    0xf8, 0xe7, 0x37, 0x57, 0x46, 0xe3, 0x7c, 0x94, 0x10, 0x48, 0xf8, 0x68, 0x67, 0xa7, 0xff, 0x10,
+    0x40, 0x7a, 0xd3, 0x90, 0xc8, 0xb4, 0x1f, 0x74, 0x1f, 0x44, 0x00, 0xe3, 0x4d, 0x45, 0x92, 0x64,
+    0xd7, 0x44, 0x66, 0xe7, 0x4b, 0xd1, 0xee, 0xfa, 0x2b, 0x33, 0x16, 0x51, 0x12, 0x4e, 0xb3, 0x71,
+    0xf9, 0x9d, 0xc8, 0x8b, 0x38, 0x4b, 0x81, 0xa9, 0xf5, 0x4d, 0xbb, 0xfd, 0x79, 0x16, 0x46, 0x71,
+    0x7a, 0xe9, 0x4a, 0xb5, 0x97, 0x64, 0xbd, 0xf7, 0xa7, 0xfd, 0x7e, 0x01, 0xcf, 0x07, 0x5e, 0x3a,
+    0x4e, 0x12, 0xab, 0xfd, 0x6c, 0x9a, 0xf6, 0x44, 0xe4, 0xb4, 0x27, 0x61, 0x51, 0x9e, 0x89, 0x9f,
+    0x74, 0x9b, 0x14, 0xc3, 0xd1, 0xeb, 0x27, 0x6f, 0x8f, 0x9f, 0x1d, 0xbd, 0x3e, 0x87, 0x8e, 0x07,
+    0x4e, 0xeb, 0x8b, 0x6f, 0x9f, 0x9f, 0x77, 0x74, 0xdf, 0x43, 0xdd, 0x87, 0x0d, 0x6f, 0x8f, 0x4f,
+    0x5f, 0xbc, 0x7a, 0x7d, 0x72, 0x76, 0xd6, 0x39, 0x7d, 0xf9, 0xf6, 0x87, 0xd3, 0xd7, 0x00, 0xb0,
+    0x65, 0x24, 0xfb, 0xf2, 0xfc, 0xf5, 0xe9, 0xf3, 0xb7, 0x67, 0xdf, 0x77, 0xce, 0x8f, 0x9f, 0xd9,
+    0x6b, 0xad, 0x7a, 0x1e, 0x7f, 0x7b, 0x7e, 0x7e, 0xfa, 0x12, 0x7a, 0x36, 0xab, 0x3d, 0xaf, 0x4e,
+    0xbf, 0x3f, 0x79, 0x6d, 0xfa, 0xe7, 0x69, 0x3e, 0xef, 0x3c, 0x39, 0xc1, 0xd1, 0xb6, 0xab, 0x3d,
+    0xdf, 0x9c, 0xfe, 0xe1, 0xec, 0xbc, 0x73, 0xfc, 0x8f, 0xd0, 0x77, 0x7f, 0x0e, 0xeb, 0xe4, 0xfc,
+    0xd5, 0x69, 0xe7, 0xe5, 0xb9, 0xad, 0x57, 0x30, 0x81, 0x17, 0x47, 0x2f, 0x61, 0x96, 0x47, 0x5f,
+    0x77, 0x8e, 0x91, 0xc9, 0xc9, 0x93, 0xe3, 0x6a, 0xdf, 0xf9, 0xe9, 0xd7, 0x5f, 0x3f, 0x3f, 0x71,
+    0xf9, 0xe4, 0x9e, 0xe3, 0xe7, 0x3c, 0xd4, 0x56, 0xb5, 0x83, 0x18, 0x74, 0xf9, 0x93, 0xe3, 0x9c,
+    0x7e, 0x77, 0xe2, 0xf2, 0x26, 0x11, 0x4e, 0x1c, 0xb6, 0x8e, 0x7e, 0xe8, 0x9c, 0xbd, 0x3d, 0x3b,
+    0x3e, 0xa2, 0x61, 0xb7, 0xb7, 0x1e, 0x3e, 0xd0, 0x72, 0x87, 0xff, 0xcb, 0x3c, 0x4b, 0x9e, 0x85,
+    0x69, 0x94, 0x68, 0x25, 0xef, 0x8f, 0xd3, 0x5e, 0x89, 0x2a, 0x13, 0x89, 0xee, 0xf8, 0x32, 0x68,
+    0xb5, 0x5a, 0x61, 0x7e, 0x59, 0x34, 0x40, 0xa9, 0x11, 0x29, 0x4b, 0x44, 0x2b, 0xc9, 0x4c, 0xf3,
+    0xde, 0xca, 0x6c, 0x25, 0xee, 0x7b, 0x41, 0x94, 0xf5, 0xc6, 0x43, 0x91, 0x96, 0xad, 0x5c, 0x84,
+    0xd1, 0xf4, 0xac, 0x0c, 0x4b, 0xd8, 0xb1, 0x07, 0x07, 0x9e, 0x9f, 0xb0, 0xa2, 0xf9, 0x48, 0x40,
+    0x03, 0x85, 0x51, 0x74, 0x72, 0x05, 0x0f, 0xcf, 0xe3, 0xa2, 0x14, 0xa9, 0xc8, 0x03, 0xff, 0xc9,
+    0xe9, 0x8b, 0x63, 0xe0, 0x06, 0xdb, 0x00, 0x41, 0x44, 0xa0, 0xd9, 0x45, 0x09, 0x7b, 0xf2, 0x49,
+    0x58, 0x0c, 0xba, 0x59, 0x98, 0x47, 0x38, 0x92, 0x27, 0x40, 0x55, 0x81, 0x8e, 0xdb, 0x13, 0x10,
+    0x13, 0x9a, 0xed, 0x6a, 0x27, 0xc0, 0x23, 0x0f, 0xe7, 0x03, 0x31, 0x14, 0x08, 0x8a, 0x2f, 0xcf,
+    0x69, 0x0f, 0x04, 0x8d, 0x56, 0x39, 0x10, 0x69, 0x10, 0xa7, 0x71, 0xf9, 0xbd, 0xe8, 0x9e, 0x81,
+    0x92, 0x8b, 0xd2, 0x25, 0x66, 0x03, 0x23, 0xa1, 0xca, 0xde, 0x29, 0xf3, 0x31, 0x6c, 0x9d, 0x5c,
+    0x80, 0x91, 0x48, 0xbd, 0xbe, 0x28, 0x7b, 0x83, 0xc0, 0xdf, 0x08, 0x47, 0xf1, 0x06, 0x03, 0xfa,
+    0x8d, 0x15, 0x1e, 0x01, 0x4c, 0xc8, 0x08, 0x84, 0x07, 0x22, 0x39, 0xf4, 0xd4, 0x73, 0xeb, 0xc7,
+    0x22, 0x4b, 0x83, 0x86, 0x01, 0x49, 0x23, 0x91, 0xf3, 0x58, 0xd0, 0xd6, 0x0b, 0x91, 0x98, 0xc8,
+    0xf3, 0x2c, 0x47, 0x24, 0x25, 0x7a, 0x6a, 0x08, 0xfc, 0x5f, 0xfe, 0xe3, 0x2f, 0xde, 0x09, 0xf5,
+    0x49, 0xf1, 0xca, 0x5d, 0xbd, 0x0b, 0x62, 0x23, 0x10, 0x4d, 0x16, 0xd8, 0x06, 0xf4, 0x9b, 0x05,
+    0xbb, 0xde, 0x9b, 0xb9, 0xd3, 0xb5, 0x99, 0x08, 0x18, 0xc5, 0x59, 0xb7, 0x32, 0x2e, 0x13, 0xb4,
+    0xc4, 0xdc, 0xc5, 0xaf, 0x7b, 0xa6, 0xfb, 0x52, 0x94, 0x27, 0x89, 0xc0, 0xc7, 0xc7, 0xd3, 0x4e,
+    0x14, 0xf8, 0x91, 0x5a, 0x85, 0x73, 0x04, 0xf4, 0x41, 0xdc, 0x62, 0x52, 0xca, 0x65, 0xfe, 0x04,
+    0x2a, 0x67, 0xe3, 0x6e, 0xb9, 0x8c, 0x50, 0x21, 0xfb, 0x97, 0xd0, 0xea, 0x01, 0x99, 0x02, 0x11,
+    0xc3, 0x18, 0xd4, 0x0e, 0x08, 0xc5, 0x70, 0x4a, 0xe4, 0xcf, 0xce, 0x5f, 0x3c, 0x37, 0x64, 0x08,
+    0xa6, 0x35, 0x0c, 0x47, 0x72, 0x4d, 0x8e, 0x51, 0xfb, 0x5a, 0x3f, 0x66, 0x71, 0x1a, 0xf8, 0x7e,
+    0x63, 0x19, 0x71, 0xde, 0x4e, 0x1f, 0xa4, 0x2f, 0xc1, 0xec, 0x21, 0xb8, 0xc9, 0x1e, 0xa5, 0x6a,
+    0xbe, 0x25, 0xf2, 0x15, 0x37, 0x54, 0x56, 0xed, 0xa7, 0xb1, 0x00, 0x4b, 0x9c, 0x86, 0xa3, 0x62,
+    0x90, 0xb1, 0xa6, 0xe2, 0x9e, 0xbc, 0x2e, 0xbc, 0x7b, 0xf7, 0xe0, 0x28, 0xad, 0xee, 0x49, 0xad,
+    0xeb, 0xad, 0xd3, 0x57, 0x27, 0x2f, 0x11, 0x1a, 0x60, 0x0a, 0x60, 0x24, 0xf8, 0xe6, 0xec, 0xf4,
+    0x65, 0xab, 0x28, 0x73, 0xd0, 0x91, 0xb8, 0x3f, 0x0d, 0x6e, 0xbc, 0x72, 0x3a, 0xc2, 0xf3, 0xa7,
+    0x90, 0xa4, 0x7d, 0x50, 0x18, 0xd2, 0x18, 0x6b, 0x74, 0x51, 0xc0, 0x29, 0x29, 0x9e, 0x95, 0xc3,
+    0x24, 0xc0, 0x55, 0x41, 0x72, 0x72, 0x43, 0x9c, 0x11, 0x21, 0x6e, 0x05, 0x1e, 0x46, 0x49, 0xd8,
+    0x13, 0xc1, 0xc6, 0xc5, 0xbd, 0xfd, 0xc3, 0x55, 0xff, 0xcd, 0xc6, 0x25, 0x1c, 0x66, 0xa8, 0x9b,
+    0xc1, 0xcd, 0x8a, 0x7f, 0xcf, 0x87, 0x41, 0xee, 0x85, 0xc3, 0xd1, 0x1e, 0x28, 0xb0, 0xbf, 0x4f,
+    0x6f, 0x49, 0x49, 0x2f, 0x87, 0xf4, 0x72, 0xc9, 0x2f, 0xab, 0xf4, 0xf2, 0xd3, 0x38, 0xa3, 0xd7,
+    0x55, 0x7f, 0x15, 0x5f, 0x3f, 0xdb, 0xfe, 0x72, 0x0f, 0x4e, 0xbd, 0xc6, 0x45, 0xef, 0x4d, 0x9d,
+    0x36, 0xe3, 0xf2, 0x05, 0xb8, 0xa6, 0xca, 0x84, 0x81, 0x57, 0x81, 0xc7, 0x98, 0xc5, 0x37, 0xf6,
+    0xb6, 0x62, 0x34, 0x31, 0xdc, 0x3f, 0x00, 0x79, 0x09, 0xd8, 0x77, 0xde, 0xbb, 0x95, 0xfd, 0x28,
+    0xbe, 0x82, 0xf3, 0x2f, 0x2c, 0x8a, 0x83, 0x55, 0x04, 0x5b, 0xe7, 0xbe, 0xd5, 0xc3, 0xf9, 0x9e,
+    0x18, 0x90, 0x57, 0x0f, 0xef, 0xde, 0xcc, 0x11, 0x86, 0xf6, 0xc6, 0x6c, 0x7f, 0x03, 0xe0, 0xeb,
+    0xb0, 0xd2, 0x7e, 0x86, 0xd4, 0x06, 0xdb, 0x4e, 0x33, 0x29, 0x72, 0x1d, 0x35, 0xea, 0x40, 0x72,
+    0x83, 0x6d, 0xc0, 0x1a, 0x39, 0x48, 0x11, 0x00, 0xe7, 0xf1, 0x08, 0x27, 0x5f, 0x87, 0x6a, 0x75,
+    0x23, 0x81, 0x11, 0xe0, 0x4b, 0xa6, 0xe8, 0xcf, 0xbb, 0x3d, 0xd2, 0x1a, 0x1e, 0x05, 0xd6, 0x9d,
+    0x74, 0xc5, 0x3a, 0xcc, 0xff, 0xf8, 0x47, 0xaf, 0xa6, 0xcf, 0x3a, 0xd2, 0xc9, 0x42, 0xa2, 0x5b,
+    0x20, 0x2e, 0x41, 0xf2, 0x20, 0x3e, 0xdf, 0x5f, 0x48, 0xb2, 0x82, 0x66, 0xfb, 0x54, 0x17, 0x72,
+    0x39, 0xde, 0x00, 0x05, 0x7a, 0xe4, 0x4e, 0xda, 0x2e, 0xfc, 0x88, 0x6a, 0xc3, 0xce, 0xd6, 0x85,
+    0xec, 0xeb, 0x21, 0xe6, 0x1b, 0x64, 0xd1, 0x6e, 0xc0, 0x6d, 0xa4, 0x78, 0xa9, 0x2c, 0x25, 0xfa,
+    0x7b, 0xeb, 0xdc, 0x89, 0xa2, 0x5a, 0x3c, 0x0e, 0xe0, 0x15, 0xa3, 0x30, 0x55, 0x88, 0x8c, 0xb2,
+    0x1e, 0x83, 0x57, 0xb9, 0x7a, 0xb8, 0x1f, 0x57, 0x9a, 0x8b, 0x6b, 0x34, 0xdb, 0x5e, 0xf7, 0x72,
+    0xdd, 0x91, 0xbe, 0xc3, 0xd3, 0x0c, 0xf0, 0x36, 0xe2, 0xc3, 0x3a, 0x80, 0x24, 0xec, 0x8a, 0x04,
+    0x97, 0x06, 0x47, 0x3c, 0x7c, 0x67, 0xcc, 0xc1, 0xcc, 0x2c, 0xd1, 0x4c, 0xed, 0x2e, 0x77, 0x42,
+    0xda, 0x48, 0xae, 0xe3, 0x54, 0xd8, 0x9f, 0xa5, 0xc7, 0x55, 0xd0, 0xf6, 0x83, 0xd5, 0xbb, 0x37,
+    0x71, 0x34, 0x7b, 0x4b, 0xef, 0x30, 0x32, 0xeb, 0xf0, 0xac, 0x46, 0x22, 0x3d, 0x65, 0xba, 0x50,
+    0x25, 0x7b, 0x61, 0x7a, 0x15, 0x16, 0x36, 0x3e, 0xc2, 0xac, 0x56, 0x30, 0x08, 0x08, 0xe7, 0xc4,
+    0x4f, 0x4a, 0x9b, 0xee, 0xde, 0xb0, 0x4c, 0x66, 0xf3, 0x2a, 0xdf, 0xcf, 0xb2, 0x92, 0x47, 0xb0,
+    0x25, 0x4b, 0x5d, 0x57, 0x21, 0x38, 0xce, 0x1e, 0x5a, 0x8c, 0xf5, 0x79, 0xfd, 0x55, 0xf2, 0xb3,
+    0x38, 0x22, 0xf8, 0xd5, 0xc3, 0xf5, 0x75, 0x29, 0xb3, 0x1a, 0x92, 0xe0, 0x0f, 0x94, 0xe3, 0xc2,
+    0x46, 0x92, 0x2d, 0x87, 0x1a, 0xa7, 0xb2, 0x0b, 0x6e, 0x25, 0xe2, 0x5b, 0xcb, 0x95, 0x10, 0xf8,
+    0xa8, 0xaa, 0xb3, 0x1a, 0xbf, 0x62, 0xc6, 0xf5, 0x06, 0x65, 0xd9, 0x7c, 0xad, 0x79, 0xda, 0xd3,
+    0xad, 0x5a, 0x4c, 0x3e, 0x8d, 0x02, 0x79, 0x50, 0x49, 0xbb, 0x69, 0x79, 0x8a, 0x17, 0xf2, 0x55,
+    0x6d, 0x52, 0xf9, 0x36, 0xa0, 0xde, 0xbd, 0x45, 0x46, 0x56, 0xe3, 0x68, 0x3b, 0xab, 0xdc, 0x89,
+    0x1a, 0x28, 0x36, 0x73, 0x0a, 0xd0, 0xb2, 0x5c, 0xf5, 0xe0, 0xb6, 0x69, 0x93, 0x36, 0x47, 0x11,
+    0xd2, 0x66, 0xa7, 0xe6, 0x3e, 0x60, 0x1d, 0x56, 0x15, 0xfb, 0xc0, 0xd8, 0xbc, 0x99, 0x46, 0xd9,
+    0xb5, 0xc8, 0xd7, 0x65, 0x93, 0xb3, 0xee, 0xb2, 0xe9, 0xb0, 0x16, 0xd7, 0x9c, 0x14, 0x60, 0xaa,
+    0xef, 0xde, 0xd0, 0x8c, 0xb4, 0xdd, 0x86, 0x06, 0x8b, 0x67, 0xd7, 0x1a, 0x5b, 0xb4, 0x78, 0xe8,
+    0xee, 0xb8, 0x2c, 0xb3, 0xd4, 0xdd, 0x9c, 0xdc, 0x56, 0x07, 0x67, 0x71, 0xb8, 0xea, 0x65, 0x69,
+    0x2f, 0x89, 0x7b, 0xef, 0x0f, 0x56, 0xcb, 0xec, 0xf2, 0x32, 0x11, 0x6a, 0x69, 0x7d, 0xea, 0xf6,
+    0x1b, 0xab, 0x75, 0xc3, 0xf1, 0x41, 0xf6, 0xcb, 0xbf, 0xff, 0x97, 0x62, 0x88, 0xf6, 0x94, 0x99,
+    0x36, 0x2a, 0xeb, 0xea, 0xe1, 0xe9, 0xd3, 0xa7, 0x66, 0x03, 0xf1, 0xc8, 0x4b, 0xa6, 0xb0, 0x58,
+    0x2b, 0x99, 0xfc, 0xe1, 0xd9, 0x14, 0xae, 0x02, 0x43, 0xaf, 0x93, 0x86, 0xa0, 0x8a, 0x57, 0x62,
+    0xf1, 0xde, 0x5c, 0xba, 0xb8, 0x7c, 0x41, 0xbc, 0xd5, 0xb2, 0x7e, 0xca, 0x42, 0xd6, 0x74, 0x9a,
+    0xf3, 0xfb, 0x53, 0xd7, 0xd8, 0x50, 0x8a, 0x62, 0x70, 0xfb, 0xb3, 0xdc, 0xe6, 0xcc, 0x34, 0x56,
+    0xb7, 0xaf, 0x45, 0xa1, 0xb8, 0x8e, 0xe1, 0xd8, 0x71, 0xf5, 0x83, 0xce, 0x12, 0x17, 0x00, 0x9b,
+    0xe3, 0x74, 0x34, 0x2e, 0xc9, 0xad, 0x43, 0x03, 0x2e, 0x7a, 0xef, 0xbb, 0xd9, 0xc4, 0x1d, 0x0f,
+    0xfa, 0x49, 0x6d, 0x06, 0x18, 0x9e, 0x58, 0xa6, 0x37, 0xb6, 0xa5, 0x95, 0x1c, 0x14, 0x49, 0x4c,
+    0x92, 0x32, 0xab, 0x47, 0x6c, 0x2c, 0x00, 0x5e, 0xa8, 0x12, 0x8e, 0x6a, 0x7d, 0xd4, 0xfa, 0x7f,
+    0xc4, 0xb6, 0xfe, 0x3b, 0x6c, 0x64, 0x77, 0x8f, 0x86, 0x64, 0x63, 0xe5, 0x26, 0x9d, 0xf3, 0x11,
+    0xd4, 0x94, 0xe6, 0x4d, 0xbe, 0xb5, 0x89, 0xe9, 0x4f, 0xcd, 0x5a, 0x9c, 0x4c, 0x44, 0x6f, 0x5c,
+    0x8a, 0xb9, 0x8d, 0x78, 0x8b, 0x0d, 0x43, 0xd1, 0x8f, 0xdf, 0x8b, 0xc0, 0x6c, 0x9d, 0x26, 0x55,
+    0x72, 0x75, 0xda, 0x56, 0x5e, 0x8a, 0x9e, 0xad, 0xba, 0xd0, 0x35, 0x8a, 0x3c, 0x8c, 0x53, 0x6c,
+    0x51, 0xf3, 0x87, 0x57, 0x90, 0xe7, 0x30, 0x9c, 0x38, 0x8d, 0xe1, 0x04, 0x1a, 0xe9, 0x60, 0x9d,
+    0x87, 0xcd, 0x52, 0xa2, 0x24, 0x87, 0xa8, 0xc8, 0xbe, 0xe9, 0x95, 0x83, 0xb8, 0x68, 0x11, 0x6a,
+    0xd5, 0x96, 0xca, 0x09, 0xc8, 0xf3, 0x7a, 0xce, 0x88, 0xca, 0x76, 0x77, 0xb8, 0x5a, 0xad, 0xbf,
+    0xfd, 0x5a, 0xca, 0x98, 0x94, 0xb9, 0xe8, 0x44, 0xa2, 0x17, 0x0f, 0xe1, 0xa6, 0x0f, 0x87, 0x66,
+    0x20, 0x6f, 0x63, 0x0a, 0x1b, 0xac, 0xed, 0xa8, 0xd1, 0x2a, 0x46, 0x49, 0x5c, 0x06, 0x7e, 0xcb,
+    0x6f, 0x5c, 0x6c, 0x92, 0xfb, 0x0c, 0xce, 0x66, 0x2b, 0x11, 0xe9, 0x65, 0x39, 0xd8, 0xfb, 0xdd,
+    0x69, 0x84, 0x28, 0x47, 0xe0, 0x0f, 0x97, 0xcb, 0xce, 0x41, 0x0d, 0x83, 0xd3, 0xfb, 0xf0, 0x1e,
+    0xd3, 0x1b, 0x0b, 0xc1, 0xcf, 0x24, 0xae, 0x59, 0xdc, 0xf5, 0x4d, 0x58, 0xd4, 0x5f, 0xfe, 0xfc,
+    0x2f, 0xd6, 0xb6, 0xb2, 0x55, 0x30, 0x1d, 0x0f, 0xbb, 0xa8, 0x74, 0xd5, 0xb1, 0xa5, 0xea, 0xfd,
+    0x0a, 0x5d, 0x44, 0x76, 0xec, 0x56, 0x9a, 0x0d, 0xae, 0x4e, 0x98, 0x4e, 0x7d, 0xe8, 0x8f, 0xc2,
+    0x32, 0x5c, 0x57, 0x8b, 0x8b, 0x80, 0xea, 0x79, 0x99, 0x1e, 0x2b, 0x8b, 0x0e, 0x7c, 0xce, 0x4f,
+    0xb5, 0xa2, 0xc7, 0x7f, 0x4b, 0xa9, 0xa2, 0x50, 0xd7, 0xe6, 0x5d, 0x86, 0x5b, 0x2a, 0xb9, 0x0a,
+    0xca, 0xfe, 0x0e, 0x4d, 0xd6, 0x8f, 0x19, 0xf8, 0x30, 0x30, 0x71, 0x57, 0x41, 0xeb, 0x00, 0x46,
+    0xa1, 0xc3, 0x1a, 0xbd, 0xd2, 0x9a, 0xe6, 0x61, 0xe9, 0xac, 0x1d, 0xbe, 0x93, 0x44, 0x49, 0x86,
+    0x22, 0x8f, 0xb2, 0xeb, 0x14, 0xe5, 0x0a, 0x37, 0xaf, 0x6f, 0x24, 0x31, 0x23, 0x58, 0x81, 0x21,
+    0xd5, 0xc6, 0xa2, 0x31, 0xdf, 0xa7, 0x59, 0xf7, 0x23, 0x4e, 0x9d, 0xb7, 0x08, 0xbf, 0xd4, 0xe9,
+    0xb8, 0x95, 0x7d, 0x6b, 0xb7, 0xda, 0xed, 0xa6, 0x87, 0xff, 0x7f, 0xd0, 0xb6, 0xc9, 0xd5, 0xc4,
+    0xa0, 0x81, 0x75, 0x25, 0x71, 0x82, 0xb3, 0x81, 0x31, 0x6d, 0xa3, 0x3c, 0x2b, 0x33, 0x60, 0x1b,
+    0x4c, 0xdb, 0x35, 0x38, 0x49, 0xd9, 0x75, 0x2b, 0xc9, 0xc0, 0x51, 0x02, 0x94, 0x96, 0xe9, 0xc2,
+    0x00, 0xf4, 0xa0, 0x2c, 0x47, 0xc5, 0xae, 0xef, 0x7d, 0xe5, 0xf9, 0xd7, 0x05, 0x3e, 0xec, 0xe2,
+    0xc3, 0xae, 0xaf, 0xee, 0x16, 0xd7, 0xc5, 0xb7, 0x39, 0x52, 0x79, 0x77, 0xf7, 0x46, 0x21, 0xce,
+    0x36, 0x36, 0xee, 0xde, 0x54, 0xa9, 0x0e, 0xb2, 0xa2, 0x4c, 0xc3, 0xa1, 0x98, 0xed, 0x3e, 0xda,
+    0x04, 0x7e, 0xaf, 0xd1, 0xa8, 0xa6, 0xe2, 0xda, 0x44, 0xd3, 0x02, 0xa2, 0xd4, 0xc0, 0xae, 0x56,
+    0x96, 0x66, 0x23, 0x81, 0x77, 0x15, 0x35, 0x8f, 0x80, 0xf5, 0xb5, 0x3e, 0x6b, 0x55, 0x97, 0x76,
+    0xa9, 0xa4, 0x56, 0xc6, 0x23, 0xd0, 0x0f, 0x3c, 0x7e, 0x10, 0x1d, 0xe8, 0x9d, 0x91, 0xab, 0x14,
+    0x60, 0x00, 0x1a, 0x83, 0x5e, 0x72, 0xd0, 0xa1, 0x28, 0x8a, 0xf0, 0x52, 0xd8, 0xe3, 0xb2, 0x52,
+    0xc0, 0xe0, 0x65, 0x3e, 0x35, 0xe7, 0x02, 0xe8, 0x1a, 0x00, 0x51, 0xb8, 0x6f, 0x14, 0xe6, 0x85,
+    0x60, 0xb0, 0x16, 0xb6, 0x37, 0xd4, 0x60, 0xdf, 0x76, 0x02, 0xf9, 0x3e, 0xf3, 0x28, 0x1c, 0xed,
+    0x71, 0x3c, 0xda, 0x4e, 0x05, 0xcc, 0xc5, 0xa3, 0x91, 0x1a, 0x46, 0x98, 0xb5, 0x54, 0x68, 0x2c,
+    0x13, 0x97, 0xa6, 0xe0, 0xa1, 0xe4, 0x16, 0xe6, 0x5d, 0x88, 0xaa, 0x8c, 0x16, 0x4c, 0x94, 0xe2,
+    0xd5, 0xf2, 0x6a, 0x37, 0x2f, 0xc6, 0xfd, 0xda, 0x9c, 0x5f, 0xad, 0xc8, 0xd7, 0xd6, 0xcc, 0xa5,
+    0x32, 0x09, 0xa7, 0x30, 0xfc, 0x8b, 0xb0, 0x1c, 0xa0, 0x91, 0x0c, 0x36, 0xdb, 0xed, 0xb6, 0xf7,
+    0x05, 0xbf, 0xc3, 0xad, 0x25, 0xd8, 0x6a, 0xce, 0xe7, 0x19, 0x1b, 0x4d, 0x6f, 0x1b, 0xc0, 0xda,
+    0xc0, 0x0a, 0x2c, 0x17, 0x66, 0x0c, 0x31, 0x54, 0xee, 0x28, 0x69, 0x93, 0x29, 0xdb, 0x09, 0x0b,
+    0x33, 0x67, 0x19, 0xd1, 0xb7, 0xd6, 0x67, 0x89, 0x48, 0x8d, 0x10, 0xa9, 0xd1, 0x91, 0xa2, 0xb3,
+    0x49, 0xdc, 0x05, 0x93, 0xe1, 0x5f, 0x7c, 0x6e, 0x99, 0x20, 0x7e, 0x38, 0x1a, 0x25, 0x53, 0x0e,
+    0xed, 0x1f, 0xd3, 0x49, 0xe0, 0x00, 0xa8, 0xd3, 0x5e, 0xe7, 0x73, 0xb0, 0x4f, 0xa6, 0x3f, 0x29,
+    0x40, 0x37, 0xc8, 0xae, 0x8f, 0xf9, 0xd5, 0xed, 0xab, 0x45, 0x74, 0x83, 0xd7, 0x77, 0x60, 0x1b,
+    0x8e, 0xd3, 0x48, 0xf4, 0xc1, 0x24, 0x46, 0x18, 0x92, 0x5e, 0x00, 0xe3, 0xb4, 0xa8, 0x59, 0xdc,
+    0x71, 0x32, 0x17, 0x2a, 0x9b, 0xe3, 0x26, 0x70, 0x2a, 0x01, 0xf0, 0x86, 0xb1, 0x26, 0x0e, 0x57,
+    0x05, 0xec, 0x27, 0x87, 0x17, 0x35, 0x86, 0xda, 0x6c, 0xd8, 0x89, 0xdb, 0x4d, 0xf3, 0x88, 0x18,
+    0x87, 0x3a, 0xcd, 0xb9, 0x06, 0x47, 0x17, 0xa9, 0x54, 0x25, 0xdc, 0x8e, 0x83, 0x98, 0xfd, 0xaa,
+    0x10, 0xb1, 0xb5, 0xcc, 0x43, 0xf0, 0xd7, 0x71, 0x7b, 0xab, 0xad, 0x64, 0x64, 0xcb, 0x7a, 0x25,
+    0xa2, 0xe3, 0x24, 0x86, 0xad, 0x57, 0xcc, 0x73, 0x26, 0x73, 0x74, 0xd4, 0x7d, 0x9c, 0x8d, 0xd3,
+    0xf2, 0x04, 0xcd, 0xd4, 0xe2, 0xec, 0x83, 0x01, 0xf4, 0x55, 0x0c, 0xc4, 0xc6, 0x25, 0x92, 0x76,
+    0x43, 0x25, 0x89, 0x52, 0xcb, 0x15, 0xc7, 0xfa, 0x2d, 0x85, 0xc8, 0x23, 0xda, 0x56, 0xe6, 0xad,
+    0xd5, 0xcf, 0xf2, 0x93, 0xb0, 0x37, 0xa0, 0x80, 0x15, 0xe5, 0x9a, 0x24, 0xe3, 0x74, 0x00, 0x2c,
+    0x65, 0x59, 0xc6, 0x79, 0x41, 0xae, 0x3e, 0x1f, 0x17, 0xbe, 0x0e, 0xf8, 0xf0, 0x4d, 0xf0, 0xd6,
+    0xd8, 0x0c, 0xae, 0xa6, 0x2d, 0x47, 0x46, 0x3e, 0xe5, 0x63, 0x65, 0xaa, 0x84, 0x4a, 0x5d, 0x4a,
+    0x3f, 0xf4, 0x78, 0xb0, 0xf2, 0x77, 0x54, 0xd6, 0x5f, 0x07, 0xa2, 0x1b, 0x9c, 0x73, 0x24, 0x88,
+    0x3a, 0x52, 0xdc, 0xa7, 0x5d, 0x17, 0x6c, 0x12, 0x69, 0xcf, 0xac, 0x61, 0x17, 0x35, 0x00, 0xa7,
+    0x02, 0xd6, 0x04, 0xee, 0x10, 0x18, 0x37, 0x7d, 0x4c, 0x4a, 0xd1, 0xe3, 0xc4, 0xe6, 0xb2, 0xb0,
+    0x3b, 0x51, 0xa1, 0x58, 0xe0, 0x80, 0xf2, 0x9a, 0x64, 0xb8, 0x89, 0x60, 0xab, 0xa4, 0x50, 0x75,
+    0x50, 0x62, 0xd9, 0x42, 0x19, 0x0e, 0x47, 0x4d, 0x2f, 0x6e, 0x70, 0x46, 0xc5, 0xd3, 0x6d, 0xbb,
+    0x9e, 0xd5, 0x4d, 0x53, 0xde, 0x95, 0xd8, 0x1c, 0x73, 0xbe, 0x68, 0xbf, 0xb9, 0x88, 0xdf, 0xc8,
+    0xb4, 0x8e, 0x32, 0x57, 0x56, 0x34, 0x5c, 0x0f, 0xc6, 0xaf, 0x7b, 0xdc, 0x57, 0x1a, 0x1e, 0x8c,
+    0x86, 0x2c, 0x4c, 0x1c, 0x80, 0x4c, 0xdd, 0x19, 0x58, 0x76, 0x1e, 0x9b, 0xd4, 0x52, 0x36, 0xab,
+    0x60, 0x7b, 0x8b, 0x29, 0xdb, 0x95, 0x04, 0x8a, 0x3e, 0xb3, 0x68, 0x88, 0xbf, 0x18, 0x27, 0x65,
+    0x5c, 0x37, 0x02, 0x03, 0xca, 0x17, 0x36, 0x17, 0xb3, 0x86, 0x6b, 0xf9, 0x64, 0x8e, 0xce, 0xe8,
+    0xba, 0x4a, 0xda, 0x69, 0x75, 0xe7, 0x06, 0xd6, 0x78, 0x7d, 0x68, 0x61, 0x13, 0x98, 0x61, 0x13,
+    0xeb, 0x6c, 0x7a, 0xc6, 0x87, 0x07, 0x10, 0xf3, 0xca, 0xbe, 0xf6, 0x9e, 0x1c, 0xd8, 0xb2, 0xe5,
+    0x55, 0x9b, 0x61, 0x5b, 0x73, 0xbd, 0x96, 0x24, 0x08, 0xcb, 0x5a, 0x28, 0x6b, 0x67, 0x6c, 0x1d,
+    0x57, 0x6b, 0xa0, 0x51, 0xb1, 0xaa, 0x37, 0xd8, 0x06, 0xd8, 0xc5, 0x1c, 0x16, 0x70, 0xbd, 0x23,
+    0x32, 0x93, 0x3a, 0x9c, 0xa9, 0x66, 0x58, 0x19, 0xd1, 0x4a, 0xe1, 0x78, 0x6c, 0x78, 0xeb, 0x9e,
+    0xcb, 0x95, 0xb2, 0x3a, 0x16, 0x15, 0x65, 0x51, 0xe1, 0xf2, 0x22, 0x29, 0xec, 0xdb, 0x65, 0x26,
+    0x9a, 0x21, 0x3d, 0x2a, 0x43, 0x55, 0x64, 0x12, 0x89, 0xab, 0xb8, 0x27, 0xf0, 0xb4, 0x35, 0xda,
+    0x6e, 0x5d, 0x00, 0xd0, 0x0d, 0x43, 0xb6, 0x02, 0x7b, 0x6e, 0x98, 0xae, 0xaa, 0xe3, 0xe4, 0x2b,
+    0xb3, 0x23, 0x3c, 0x6b, 0x77, 0x80, 0x1d, 0xb1, 0xf9, 0x72, 0x8e, 0x57, 0x58, 0xf3, 0x61, 0x58,
+    0x2e, 0x1c, 0xbe, 0x96, 0xbb, 0x56, 0x99, 0x3d, 0x07, 0xd7, 0x31, 0xa1, 0x76, 0x79, 0xf7, 0xbe,
+    0x78, 0xd3, 0xf4, 0x6e, 0xbc, 0x41, 0x36, 0xce, 0x37, 0xb7, 0x76, 0x39, 0x05, 0x5f, 0xcd, 0xc0,
+    0xcf, 0x9f, 0xd2, 0x7c, 0x6d, 0x33, 0x47, 0x95, 0x9d, 0xc7, 0xc7, 0x39, 0x52, 0xb7, 0xca, 0x0b,
+    0xcf, 0x9f, 0xa3, 0xea, 0xd4, 0xfa, 0x6d, 0xce, 0x52, 0xd6, 0x05, 0x31, 0x89, 0xe1, 0x4e, 0x41,
+    0x75, 0x04, 0x0b, 0xad, 0x33, 0xb3, 0x25, 0xed, 0xb3, 0x8f, 0xd2, 0xe5, 0x96, 0xf7, 0xe0, 0x56,
+    0x2b, 0x93, 0xc7, 0x2d, 0x19, 0x6b, 0xb3, 0x9f, 0x8b, 0x61, 0x76, 0x25, 0x7c, 0xc5, 0xac, 0x1a,
+    0x04, 0xdf, 0xd5, 0x73, 0x8b, 0x61, 0xf8, 0xc8, 0x35, 0xe6, 0x8a, 0x93, 0xb6, 0x70, 0x9f, 0x41,
+    0x83, 0x6c, 0x86, 0x61, 0xb2, 0xb8, 0xc9, 0xd1, 0xfb, 0xb7, 0xb3, 0xc1, 0x0c, 0x73, 0x1d, 0x47,
+    0x97, 0xa8, 0x82, 0xbb, 0xd5, 0xbc, 0x87, 0xd3, 0xbd, 0xb7, 0x98, 0x1b, 0x10, 0x9b, 0x4e, 0xee,
+    0xe3, 0xf0, 0x7b, 0x55, 0x9e, 0xf4, 0x45, 0xb0, 0x13, 0x2d, 0x63, 0xad, 0x5a, 0x96, 0x80, 0x57,
+    0x94, 0xf9, 0x62, 0x82, 0xc5, 0x95, 0x07, 0xd6, 0x30, 0x58, 0x71, 0x00, 0xe6, 0xad, 0x3c, 0x8a,
+    0x7e, 0x0c, 0x7b, 0xd0, 0x8f, 0xdc, 0x05, 0x7e, 0x57, 0x80, 0x0a, 0x0b, 0x98, 0x24, 0x78, 0x90,
+    0xc8, 0xa8, 0xb4, 0x39, 0xd5, 0x1a, 0x03, 0x57, 0x97, 0x6a, 0x3c, 0x4c, 0x63, 0x4c, 0x3b, 0x68,
+    0xd9, 0x6c, 0x7b, 0xce, 0x45, 0x75, 0x17, 0xdc, 0x87, 0x59, 0xa1, 0x8b, 0x1b, 0x3e, 0x6f, 0x8a,
+    0x5d, 0x03, 0x48, 0x07, 0x16, 0x5d, 0x65, 0xd1, 0x6e, 0xd2, 0x83, 0x34, 0x84, 0x68, 0x18, 0xe1,
+    0x0a, 0xba, 0x2b, 0xf3, 0xba, 0x2d, 0x2c, 0xa0, 0xf3, 0x66, 0x6f, 0xf6, 0x56, 0x4c, 0x65, 0x9e,
+    0x45, 0x7b, 0x29, 0x41, 0xb3, 0x07, 0xd5, 0xc9, 0x6a, 0x1d, 0xe7, 0x1d, 0x3c, 0xcd, 0x95, 0x3e,
+    0x47, 0x79, 0x78, 0x5d, 0x33, 0x25, 0x0d, 0xd9, 0xf4, 0xe6, 0x47, 0x6f, 0xd4, 0x88, 0xa5, 0x72,
+    0xd0, 0x20, 0x21, 0x75, 0xc4, 0x10, 0x33, 0x96, 0x37, 0xa7, 0xaa, 0x06, 0xe7, 0x12, 0xde, 0x38,
+    0x31, 0xd8, 0xce, 0x17, 0x6a, 0xca, 0xf6, 0x74, 0xad, 0xc4, 0x34, 0x3b, 0x37, 0x40, 0x18, 0x94,
+    0x48, 0x4c, 0xd4, 0x71, 0xaf, 0x04, 0xad, 0x3a, 0xa5, 0x2c, 0x79, 0xb4, 0x0b, 0x02, 0x25, 0xea,
+    0x8e, 0x70, 0xf1, 0xc8, 0xaf, 0x95, 0x2e, 0xf1, 0x7c, 0x1b, 0xe9, 0xf0, 0xe4, 0x1c, 0x81, 0xcc,
+    0x23, 0x31, 0xf3, 0x58, 0xe9, 0x35, 0x2f, 0x0d, 0x4e, 0x30, 0x2f, 0xf7, 0xf1, 0x3a, 0x6c, 0x42,
+    0x68, 0x6c, 0xe5, 0xe1, 0xdd, 0x61, 0x4c, 0xb3, 0x92, 0x92, 0x5e, 0x39, 0x21, 0x97, 0x0c, 0xfb,
+    0x90, 0x14, 0xb9, 0x69, 0x93, 0x32, 0xf0, 0xb7, 0x22, 0xe3, 0x5a, 0xc2, 0x95, 0xae, 0x74, 0xa0,
+    0x1e, 0x83, 0x3b, 0x8c, 0xf6, 0x90, 0x5d, 0x5e, 0xb8, 0x45, 0x92, 0x4b, 0x2f, 0xfb, 0xc1, 0x08,
+    0x94, 0x03, 0x00, 0x47, 0x2c, 0x7e, 0xd1, 0x5d, 0x03, 0x11, 0x5f, 0x0e, 0x4a, 0xd5, 0xc7, 0x6f,
+    0xd0, 0x59, 0x4e, 0x5a, 0xbd, 0x44, 0x84, 0x39, 0x11, 0xc2, 0xd8, 0x47, 0xd3, 0xb3, 0x69, 0xe9,
+    0x37, 0x46, 0xd0, 0x6c, 0x71, 0xd0, 0x55, 0x2f, 0x36, 0xca, 0x4b, 0x06, 0x62, 0xc1, 0x40, 0x98,
+    0x36, 0xf0, 0xd7, 0x78, 0xc7, 0x14, 0xaa, 0x77, 0x17, 0x43, 0x08, 0x74, 0x34, 0xf0, 0xfb, 0xbe,
+    0xb7, 0x65, 0xe4, 0x82, 0xe5, 0x18, 0x70, 0xb5, 0xfd, 0x8e, 0x92, 0xcc, 0x07, 0x5e, 0x27, 0xed,
+    0xe3, 0x55, 0x75, 0x2a, 0x3b, 0xc2, 0x89, 0xea, 0x58, 0x37, 0x3d, 0x60, 0x29, 0x28, 0xfc, 0xa6,
+    0x2b, 0x5d, 0xe1, 0x48, 0xb6, 0x18, 0xc0, 0xd5, 0xb3, 0x40, 0x38, 0x7d, 0xad, 0x21, 0x24, 0x6f,
+    0xca, 0x86, 0x73, 0xaf, 0x3a, 0x7a, 0x1b, 0x64, 0x0f, 0xe3, 0x14, 0xdd, 0x6e, 0xd3, 0xbb, 0xaf,
+    0x19, 0x6c, 0xd8, 0xac, 0x4a, 0xf7, 0xdc, 0xc0, 0x1d, 0x6a, 0x7e, 0x1b, 0x36, 0xe7, 0xda, 0x8d,
+    0x67, 0xef, 0xcd, 0x50, 0x38, 0x30, 0xd3, 0xad, 0xea, 0x09, 0xe5, 0x0e, 0x00, 0x57, 0x93, 0x59,
+    0x37, 0x23, 0xc3, 0x2e, 0xd1, 0xa5, 0x99, 0xa3, 0x30, 0x92, 0xe5, 0x72, 0x5b, 0x6d, 0xa7, 0x52,
+    0xf8, 0x7b, 0xa9, 0x15, 0x8e, 0x92, 0xac, 0x7b, 0x5b, 0xde, 0x17, 0x0a, 0xc7, 0x01, 0x7f, 0xa6,
+    0x34, 0xc5, 0xd5, 0x9c, 0x5a, 0x84, 0xc9, 0x69, 0x1f, 0x00, 0x69, 0xcb, 0x92, 0x49, 0x93, 0x2c,
+    0xac, 0xd1, 0x71, 0xa9, 0x46, 0xde, 0xd0, 0xab, 0xbd, 0x0e, 0xa7, 0x7b, 0x03, 0xa8, 0x10, 0x82,
+    0xa2, 0x31, 0x25, 0x1a, 0x52, 0xf8, 0x36, 0x0d, 0x9b, 0x9b, 0x75, 0x4f, 0x1a, 0x13, 0x6b, 0xf6,
+    0x0d, 0xa0, 0x9c, 0xb3, 0xbb, 0xf1, 0x85, 0x0d, 0xcc, 0x6a, 0x5d, 0xc0, 0x81, 0xf4, 0x1e, 0x7c,
+    0x99, 0x29, 0x25, 0xed, 0xad, 0xd2, 0xec, 0xaf, 0xb0, 0xd2, 0x79, 0xfb, 0xfe, 0xe6, 0xce, 0x0e,
+    0x1d, 0x5d, 0x9f, 0x89, 0x2d, 0xf1, 0xa8, 0xdf, 0xf6, 0x19, 0x2b, 0x81, 0x83, 0x49, 0xc9, 0x6b,
+    0x53, 0xaa, 0x17, 0x95, 0x76, 0x53, 0xf0, 0x0b, 0xfe, 0xec, 0x63, 0x09, 0xab, 0x17, 0xaf, 0xad,
+    0x19, 0xc3, 0x80, 0x61, 0x99, 0xea, 0xcc, 0x25, 0xdb, 0x1b, 0xde, 0x7d, 0x9a, 0x2f, 0x13, 0xef,
+    0x8a, 0xcb, 0x38, 0x7d, 0x15, 0x96, 0x03, 0xda, 0xb2, 0xd0, 0x80, 0xee, 0xc1, 0x79, 0x16, 0x48,
+    0xe4, 0xa6, 0x37, 0x6d, 0x18, 0x2e, 0xa0, 0xbd, 0xb2, 0x60, 0x73, 0x60, 0x3c, 0xc5, 0x40, 0x5f,
+    0x06, 0xc8, 0x60, 0xe1, 0x05, 0x83, 0x1e, 0xd4, 0x96, 0x43, 0xdd, 0xe2, 0x47, 0x62, 0x19, 0xf0,
+    0xfa, 0x71, 0x92, 0x2c, 0x10, 0xcc, 0x97, 0xf7, 0xc3, 0xed, 0xee, 0x23, 0x16, 0xcc, 0x83, 0xfb,
+    0x0f, 0xef, 0x3f, 0xea, 0x4a, 0xc1, 0xf4, 0x33, 0xba, 0x41, 0xfa, 0x9b, 0xed, 0xd1, 0xc4, 0x2b,
+    0xc2, 0xb4, 0x58, 0xc7, 0x3d, 0xd4, 0x97, 0xbd, 0x68, 0xb8, 0x1e, 0x87, 0x85, 0x40, 0xc6, 0x11,
+    0xaa, 0x9b, 0x95, 0x65, 0x36, 0xb4, 0x3a, 0x8f, 0x92, 0xf8, 0x12, 0x0f, 0x6d, 0x3f, 0x11, 0xfd,
+    0x52, 0x91, 0x04, 0x36, 0xce, 0xd1, 0xe2, 0x55, 0x3d, 0x56, 0x30, 0x1b, 0x70, 0xc4, 0xea, 0xe9,
+    0xce, 0x99, 0xa0, 0x2a, 0xcd, 0x1c, 0x3b, 0x3e, 0x48, 0xd4, 0xe8, 0x20, 0x52, 0x5f, 0x24, 0xdb,
+    0xea, 0x60, 0xb3, 0x15, 0xcb, 0xc4, 0xa9, 0xeb, 0x94, 0x29, 0xb8, 0xba, 0xa9, 0xd1, 0x35, 0xbb,
+    0x80, 0x6a, 0x5e, 0xab, 0x24, 0x1b, 0x87, 0xb0, 0x4b, 0xdb, 0x20, 0xf2, 0x4d, 0x10, 0xf5, 0x56,
+    0x8d, 0x7a, 0xa0, 0xd2, 0xe1, 0xf1, 0xe4, 0x94, 0xbd, 0x3b, 0x66, 0x4b, 0x73, 0xc3, 0x1b, 0xc3,
+    0x3e, 0x64, 0xeb, 0xed, 0xd9, 0xcd, 0xca, 0x1c, 0x41, 0xe9, 0x01, 0xd2, 0x29, 0x25, 0x3b, 0x95,
+    0x92, 0x48, 0xdd, 0x84, 0x1d, 0x1e, 0x30, 0xe1, 0x26, 0xee, 0x54, 0x26, 0x8a, 0x87, 0xb1, 0xa1,
+    0xc5, 0x75, 0xc5, 0xc6, 0x99, 0x34, 0x0a, 0xbc, 0x10, 0x99, 0xaf, 0xb0, 0xae, 0x0e, 0x5b, 0xa7,
+    0xc2, 0xa1, 0xb7, 0xd9, 0x6e, 0x5b, 0x76, 0xb0, 0xa2, 0xb3, 0xae, 0x80, 0x7f, 0x9d, 0x50, 0xec,
+    0x31, 0xe6, 0xf6, 0x67, 0x98, 0xf7, 0x16, 0xcc, 0xa1, 0xe9, 0x6d, 0xd3, 0x61, 0xb9, 0xa5, 0x42,
+    0xb0, 0xaf, 0x3a, 0x0d, 0xc3, 0x68, 0xa0, 0xae, 0xca, 0x95, 0x62, 0x6f, 0x2b, 0x2c, 0x69, 0x45,
+    0x2b, 0xad, 0xb3, 0xa9, 0xd0, 0x71, 0x97, 0x7f, 0x1a, 0x87, 0x70, 0xfa, 0xfc, 0x2c, 0xa2, 0x27,
+    0x22, 0x29, 0xc3, 0x42, 0xc1, 0x53, 0xd0, 0xbb, 0xa9, 0x3e, 0xf5, 0x00, 0x11, 0x8c, 0xd3, 0xd2,
+    0xbc, 0xf2, 0x75, 0xd4, 0xbc, 0x17, 0x78, 0xa5, 0x23, 0xf7, 0x40, 0x3b, 0x95, 0xdc, 0x11, 0x57,
+    0x9d, 0xde, 0x8a, 0x2f, 0x56, 0xf5, 0x6b, 0x6d, 0x47, 0x49, 0x51, 0xd0, 0xc3, 0x38, 0x64, 0x3f,
+    0x2e, 0x28, 0xa6, 0xd0, 0x6a, 0xe2, 0x62, 0x0a, 0xdf, 0xca, 0x0f, 0x8f, 0xf3, 0x50, 0x16, 0x55,
+    0x05, 0x8e, 0x00, 0xc0, 0xcc, 0xaa, 0x77, 0x4c, 0x41, 0xc1, 0x92, 0x60, 0x70, 0x1c, 0x2f, 0xb5,
+    0x4f, 0xe3, 0x89, 0x88, 0x82, 0x4d, 0x8c, 0x7f, 0xd7, 0x47, 0xc4, 0xde, 0xfd, 0xf2, 0xd7, 0xff,
+    0xf1, 0xb0, 0xa2, 0xd2, 0x22, 0x37, 0x03, 0xfb, 0x36, 0x1c, 0xe1, 0x37, 0x06, 0xff, 0x60, 0x75,
+    0x51, 0x72, 0xcb, 0x7b, 0xf6, 0xb3, 0x17, 0xdc, 0xbd, 0x51, 0x9c, 0xcc, 0xbc, 0x61, 0xd1, 0x78,
+    0xe7, 0xad, 0xad, 0x98, 0xe5, 0xc9, 0xb3, 0xd1, 0x08, 0xee, 0xf3, 0x5f, 0x79, 0xef, 0x9a, 0x16,
+    0xb2, 0x6c, 0x9e, 0x79, 0xf2, 0xe1, 0x1d, 0x1a, 0x58, 0xb8, 0x3c, 0xc2, 0xb4, 0xc1, 0xf8, 0x50,
+    0x02, 0x92, 0x4f, 0x30, 0xbc, 0xbd, 0x7b, 0x49, 0x7c, 0x25, 0xbc, 0xab, 0x58, 0x5c, 0xfb, 0xe6,
+    0x16, 0x7b, 0x0b, 0xef, 0xd3, 0x11, 0xa6, 0xe3, 0x81, 0x2a, 0x07, 0xf4, 0x46, 0x79, 0x83, 0x32,
+    0xe9, 0x89, 0x92, 0x94, 0x7b, 0x23, 0x12, 0x60, 0x71, 0x44, 0xed, 0x92, 0xee, 0xcd, 0x63, 0x71,
+    0xb4, 0x65, 0x81, 0x56, 0x28, 0xbf, 0xdb, 0xa8, 0x1a, 0x5d, 0x15, 0x2a, 0xf7, 0x13, 0x5b, 0x63,
+    0x66, 0x95, 0x08, 0x4a, 0x17, 0x8e, 0x92, 0x07, 0xf7, 0xcf, 0xb3, 0xc7, 0xd3, 0x52, 0x14, 0xba,
+    0x50, 0x5b, 0x86, 0x27, 0xe3, 0x34, 0xcc, 0xf1, 0xc8, 0x0d, 0xcb, 0xac, 0xcb, 0x7d, 0x4a, 0xe5,
+    0xba, 0x08, 0x2e, 0x13, 0x5d, 0xdf, 0xc2, 0xe5, 0xea, 0xd1, 0x51, 0x9e, 0x87, 0xd3, 0x80, 0x31,
+    0xe4, 0x71, 0xd8, 0xa8, 0x3d, 0xd4, 0x3d, 0x07, 0x46, 0x9f, 0xef, 0x44, 0x10, 0x23, 0x8e, 0x07,
+    0x0a, 0x00, 0xa7, 0x70, 0x0c, 0xdb, 0xf3, 0xa8, 0x0c, 0x62, 0x2b, 0xda, 0xc0, 0x43, 0x3b, 0x9b,
+    0xfd, 0x2a, 0xcc, 0x63, 0x74, 0xd0, 0x31, 0x53, 0x1b, 0x50, 0xb7, 0xaa, 0x38, 0x1e, 0x65, 0x32,
+    0x95, 0x26, 0x71, 0xd5, 0x12, 0x60, 0x9f, 0x34, 0x4f, 0xd8, 0x8b, 0xaf, 0xc5, 0x20, 0xee, 0x97,
+    0xec, 0x8a, 0xe0, 0x2b, 0x92, 0xc1, 0x8b, 0xb5, 0x64, 0x0d, 0xd9, 0x22, 0x0e, 0x81, 0xe2, 0xda,
+    0x1a, 0xac, 0x13, 0x63, 0xaf, 0xc1, 0xaa, 0x52, 0xf7, 0x3d, 0xaf, 0x3d, 0x79, 0xd8, 0x47, 0x07,
+    0x84, 0xe8, 0xc0, 0x26, 0x20, 0x72, 0x5f, 0x00, 0xbd, 0xad, 0x47, 0x68, 0xb1, 0xaf, 0x07, 0x31,
+    0x18, 0x54, 0x03, 0xfc, 0xa8, 0xad, 0x33, 0x24, 0xda, 0x55, 0x75, 0x6f, 0x90, 0xe9, 0xcf, 0xf1,
+    0xe5, 0xcf, 0xe1, 0x65, 0x00, 0x2b, 0x6f, 0xc5, 0x94, 0xe0, 0xcd, 0xfb, 0x1c, 0x6c, 0xe1, 0x57,
+    0xde, 0x3a, 0xf6, 0x70, 0x14, 0x67, 0x03, 0x1a, 0x76, 0xa9, 0x6b, 0x03, 0x4f, 0x38, 0x27, 0x40,
+    0x56, 0x67, 0xe1, 0x70, 0x29, 0xd1, 0x00, 0x91, 0x45, 0x53, 0x96, 0x8c, 0x2d, 0x98, 0x5e, 0x7c,
+    0xfc, 0x36, 0xe0, 0x3b, 0x12, 0x2c, 0xb9, 0x8c, 0xb6, 0x84, 0xe7, 0x55, 0x46, 0xeb, 0x85, 0x36,
+    0xad, 0xa8, 0x18, 0xac, 0x13, 0x34, 0x8c, 0x3c, 0x66, 0xa9, 0x4e, 0x80, 0x44, 0x5e, 0xa7, 0x19,
+    0x04, 0x59, 0xf1, 0xf8, 0x70, 0x52, 0x07, 0x16, 0x33, 0xea, 0xf8, 0xa2, 0x76, 0x38, 0x5a, 0xda,
+    0x3a, 0x9a, 0x2f, 0xb5, 0x47, 0x7f, 0x71, 0x26, 0x2f, 0x14, 0xe0, 0x55, 0xe0, 0xa0, 0x6b, 0x07,
+    0x8e, 0x44, 0xc9, 0x3f, 0xde, 0x73, 0x10, 0x65, 0x18, 0x72, 0x8d, 0x99, 0xfc, 0x82, 0xe5, 0x61,
+    0xe9, 0x1d, 0xc3, 0xd6, 0x48, 0xb7, 0x1a, 0xb7, 0xff, 0x68, 0x11, 0x72, 0x11, 0x3e, 0xc6, 0x4b,
+    0x8c, 0x49, 0xc7, 0xc1, 0x55, 0x0e, 0x12, 0x73, 0x8e, 0x9b, 0x6d, 0x19, 0x96, 0x1e, 0x99, 0x3d,
+    0x18, 0x97, 0x4a, 0xd2, 0x18, 0xf2, 0xf8, 0x0e, 0xac, 0x58, 0xa0, 0xc5, 0xfe, 0x78, 0xdc, 0xef,
+    0xc3, 0x40, 0xf7, 0x0d, 0xc9, 0x51, 0x2e, 0xae, 0xe2, 0x6c, 0x5c, 0xa8, 0xe4, 0x04, 0xf2, 0xd0,
+    0x2a, 0xc0, 0xca, 0x08, 0xb2, 0xda, 0xaa, 0xf2, 0x96, 0x3f, 0x75, 0xa4, 0x70, 0x83, 0x7d, 0xd7,
+    0x3b, 0xd0, 0xf8, 0x1c, 0x6e, 0xa0, 0x8d, 0x74, 0xf1, 0x46, 0xae, 0xab, 0x15, 0x7f, 0x36, 0xc4,
+    0xc1, 0xb7, 0xb4, 0xd6, 0x39, 0xcf, 0xae, 0x79, 0xa5, 0xf1, 0x61, 0x9f, 0xa1, 0xe0, 0xb1, 0xa0,
+    0x06, 0x5e, 0x71, 0x2b, 0xe6, 0x5a, 0x5d, 0x72, 0x76, 0xb3, 0x47, 0xe3, 0x62, 0x10, 0xd8, 0x61,
+    0x1c, 0xcd, 0x53, 0xd5, 0x17, 0x81, 0xc3, 0x75, 0x3c, 0x4c, 0x1b, 0x76, 0xde, 0x69, 0x91, 0x26,
+    0xa9, 0xb4, 0x0c, 0xe7, 0x10, 0xea, 0xbe, 0x38, 0x34, 0x2b, 0x3a, 0xa1, 0x1c, 0x6d, 0x40, 0xab,
+    0xd2, 0x4f, 0xb2, 0x2c, 0x0f, 0x78, 0xd3, 0x6d, 0xc3, 0xd5, 0x7a, 0x7f, 0x9f, 0xb5, 0xf2, 0x73,
+    0x7c, 0x6b, 0x78, 0x87, 0x87, 0x87, 0xa8, 0xe7, 0x8a, 0xc3, 0x0b, 0xe6, 0x08, 0x15, 0x4d, 0x3a,
+    0x46, 0xff, 0x8c, 0xd4, 0x34, 0x1c, 0x2e, 0x66, 0x0b, 0xf4, 0x0f, 0x8d, 0xe9, 0xf6, 0x16, 0xc6,
+    0x07, 0xaa, 0x98, 0x56, 0xd1, 0x33, 0x6a, 0x5d, 0x44, 0x96, 0xb2, 0xa4, 0x48, 0xc5, 0xd3, 0x24,
+    0x0b, 0x09, 0xab, 0xa1, 0x7c, 0x34, 0x85, 0xc4, 0x22, 0x7b, 0x49, 0x05, 0x49, 0xad, 0xb8, 0x78,
+    0x8a, 0xd7, 0x5e, 0x11, 0x48, 0x0a, 0x0d, 0xb0, 0x22, 0x8a, 0xd8, 0x2e, 0x3b, 0x69, 0x8e, 0x9f,
+    0xea, 0xec, 0xb1, 0x3a, 0xba, 0x2e, 0xca, 0x4d, 0xdd, 0x64, 0xa5, 0x9d, 0xac, 0xdb, 0x7c, 0x75,
+    0x14, 0xe7, 0x28, 0x6c, 0x78, 0xca, 0xb3, 0x52, 0xb9, 0x18, 0xb9, 0x1d, 0x6f, 0xbc, 0x52, 0x46,
+    0xe9, 0x55, 0x28, 0x69, 0x57, 0xe9, 0x6a, 0x5d, 0x0e, 0xdc, 0xe4, 0x60, 0xf0, 0xe0, 0x94, 0x39,
+    0x17, 0x76, 0x30, 0xf5, 0xea, 0x72, 0xfd, 0x69, 0x87, 0x2a, 0xb9, 0x16, 0x9f, 0xfe, 0xf2, 0xd4,
+    0xa7, 0xda, 0x2d, 0x13, 0x3d, 0xd2, 0xf5, 0xb8, 0xb7, 0xc1, 0x94, 0xa0, 0xd5, 0xb4, 0xe6, 0x87,
+    0x51, 0x2b, 0x7e, 0x9b, 0xe1, 0x97, 0x56, 0xc8, 0xbc, 0xb6, 0xa8, 0x84, 0x97, 0x74, 0x84, 0xa6,
+    0xaa, 0xae, 0xad, 0x7a, 0x68, 0x0a, 0xc4, 0xa8, 0x97, 0x16, 0x55, 0xee, 0xd0, 0xb5, 0x8b, 0xab,
+    0x7a, 0x03, 0x9f, 0x8b, 0xad, 0x7d, 0x29, 0xa9, 0x86, 0x9b, 0x0e, 0x35, 0x69, 0xcf, 0x8a, 0x8b,
+    0x47, 0xc0, 0x78, 0xb9, 0x3d, 0x7d, 0x49, 0xf7, 0xda, 0xd3, 0xa7, 0x4f, 0x2d, 0xbf, 0x8a, 0x0a,
+    0xbe, 0x1f, 0x73, 0x01, 0xd9, 0xb2, 0x99, 0x1a, 0x8b, 0x85, 0x08, 0x78, 0xc3, 0xfc, 0xb0, 0x60,
+    0x90, 0x0f, 0xdf, 0x45, 0x3c, 0xfb, 0x24, 0x99, 0xda, 0x4c, 0xc2, 0xf5, 0xde, 0x7a, 0xb5, 0xa4,
+    0x24, 0xe3, 0xea, 0x45, 0xe0, 0xdb, 0xf5, 0xf5, 0x7e, 0x03, 0x05, 0x53, 0x8f, 0xb1, 0x50, 0xae,
+    0x7a, 0xcc, 0x73, 0xe9, 0x7a, 0xe9, 0x97, 0x5b, 0xca, 0x56, 0x13, 0x38, 0xd3, 0x6b, 0x63, 0xbd,
+    0xde, 0x86, 0x05, 0x1b, 0x7c, 0xc1, 0x98, 0xb2, 0x08, 0xff, 0x88, 0x51, 0x71, 0xf8, 0x4a, 0x59,
+    0xbe, 0xcf, 0x6e, 0xa5, 0xd4, 0x66, 0xaa, 0x00, 0xfb, 0xb4, 0x7d, 0xc4, 0xb8, 0x2a, 0x88, 0xf7,
+    0x01, 0x5c, 0x5d, 0x1c, 0x40, 0xba, 0x69, 0x8d, 0x0a, 0x2b, 0x67, 0xbd, 0x9a, 0x14, 0xb1, 0x4f,
+    0x41, 0x2c, 0x4a, 0x25, 0xd9, 0xfd, 0x57, 0xd5, 0x98, 0xe1, 0xad, 0xe9, 0x71, 0xa9, 0xa7, 0x4f,
+    0x85, 0x21, 0xfa, 0x23, 0x66, 0x92, 0x88, 0x64, 0x97, 0x12, 0x6f, 0x16, 0xee, 0xa2, 0xa1, 0xd9,
+    0x44, 0xcb, 0x2b, 0xaf, 0xbe, 0x4e, 0x51, 0x0d, 0x56, 0x07, 0xce, 0x2a, 0x1b, 0x05, 0x3d, 0x05,
+    0x38, 0x29, 0x5a, 0xaa, 0xb6, 0xb3, 0x81, 0x4e, 0x7f, 0xbb, 0x61, 0x36, 0x9a, 0x2a, 0xed, 0x7b,
+    0x15, 0x46, 0x1f, 0x96, 0xe1, 0x28, 0x8c, 0x5c, 0x09, 0xb2, 0xec, 0xb1, 0xde, 0xc1, 0xa2, 0x63,
+    0xd8, 0xa6, 0xee, 0x8a, 0x9e, 0x58, 0xb1, 0xd6, 0x79, 0xb3, 0xeb, 0xd6, 0x6b, 0xe9, 0x42, 0x12,
+    0xcb, 0xec, 0x7e, 0xf8, 0xfa, 0xea, 0xf7, 0x2a, 0x74, 0xea, 0xae, 0xae, 0xfa, 0xde, 0x49, 0x3a,
+    0xff, 0x32, 0x1c, 0x0a, 0xfe, 0x06, 0x89, 0xc7, 0x43, 0x35, 0x66, 0x08, 0xf3, 0x41, 0x85, 0x97,
+    0xa5, 0x18, 0x3e, 0x21, 0x85, 0x9e, 0xef, 0xeb, 0xf7, 0xa9, 0xd3, 0xba, 0xd0, 0xda, 0x1f, 0xed,
+    0x5a, 0x84, 0x57, 0x7c, 0xa7, 0xfe, 0x91, 0x09, 0x45, 0x59, 0xa9, 0xaa, 0x24, 0xf9, 0x43, 0x96,
+    0x53, 0x1a, 0x4b, 0x56, 0x3b, 0xc2, 0x90, 0xb7, 0xc4, 0x62, 0x2e, 0x14, 0x5a, 0x45, 0xc8, 0xf8,
+    0x71, 0xee, 0x71, 0x36, 0x1c, 0x86, 0x69, 0x44, 0xe7, 0x5a, 0x36, 0xc2, 0xd3, 0xbc, 0xe9, 0xf1,
+    0x27, 0x05, 0x73, 0x07, 0x1c, 0x7f, 0x88, 0x65, 0xbe, 0xcc, 0x52, 0x9f, 0x6d, 0xd1, 0xcd, 0x13,
+    0xc5, 0xa9, 0x00, 0xea, 0x4b, 0x8e, 0x4c, 0x15, 0xe1, 0xdc, 0xf7, 0xc0, 0x71, 0xb4, 0xeb, 0x21,
+    0x03, 0x3c, 0xf0, 0xae, 0xcb, 0x80, 0x8c, 0x79, 0x50, 0x4a, 0x5b, 0x7d, 0x51, 0x2c, 0x69, 0x39,
+    0x65, 0x62, 0xf2, 0x0a, 0x01, 0x7e, 0x2c, 0xb1, 0x48, 0xd3, 0x7a, 0x9a, 0xc3, 0x3a, 0x06, 0x6a,
+    0x5e, 0xcc, 0x1f, 0x3a, 0xee, 0x00, 0x84, 0xee, 0x92, 0xf2, 0x7c, 0xee, 0xcb, 0xa1, 0x9a, 0x9e,
+    0xac, 0x7c, 0x54, 0xe3, 0x10, 0x60, 0x97, 0x9c, 0x61, 0x37, 0x42, 0xb4, 0x8c, 0xbe, 0x89, 0x14,
+    0x31, 0x2f, 0x4b, 0x5d, 0xec, 0x47, 0x0d, 0x8b, 0x1f, 0xba, 0x0b, 0xa3, 0xf7, 0xe6, 0xfc, 0xe6,
+    0xc3, 0x1c, 0xc0, 0xa6, 0x5a, 0xaa, 0x4a, 0xcf, 0xe6, 0x03, 0x2c, 0x2e, 0x64, 0x2e, 0xf4, 0x54,
+    0xd4, 0xfd, 0x03, 0xe0, 0xf6, 0xaa, 0x8b, 0xff, 0x02, 0xb3, 0xde, 0x28, 0xf8, 0x09, 0xc6, 0xaa,
+    0x55, 0x3a, 0xff, 0xba, 0x40, 0x93, 0xe0, 0x7e, 0xe0, 0x7d, 0xa7, 0xe6, 0x03, 0x6f, 0x37, 0xfb,
+    0xf1, 0xc9, 0xda, 0xb1, 0xf0, 0x2b, 0xf1, 0xaa, 0x56, 0xf8, 0x94, 0xc8, 0x07, 0x66, 0x77, 0x89,
+    0xdf, 0x5d, 0x6f, 0xca, 0xd9, 0xc6, 0xdb, 0xa8, 0x80, 0xfd, 0xe3, 0x16, 0x35, 0x8a, 0xd0, 0x21,
+    0xe1, 0x81, 0x1a, 0x90, 0x6f, 0x9e, 0x63, 0xea, 0x2e, 0x98, 0xc0, 0x2d, 0xce, 0xfc, 0xc8, 0x45,
+    0x43, 0x0b, 0xd4, 0xc5, 0x79, 0xe0, 0xe0, 0x4c, 0x17, 0xe0, 0x7c, 0x50, 0x9f, 0xdc, 0xda, 0x6b,
+    0x9c, 0xb5, 0xae, 0xb0, 0xd5, 0x49, 0x23, 0xfc, 0x46, 0x91, 0xea, 0x69, 0x7b, 0xe3, 0x3c, 0x87,
+    0xbf, 0xe7, 0x61, 0x7e, 0x89, 0x35, 0x2d, 0xea, 0x82, 0x42, 0x71, 0x06, 0x6d, 0xf3, 0x01, 0x41,
+    0xdb, 0x7a, 0xec, 0x23, 0x3b, 0x6f, 0x12, 0x4e, 0x34, 0x10, 0xfe, 0x36, 0x07, 0x8a, 0xb3, 0x4d,
+    0xe2, 0x6c, 0xa3, 0xeb, 0x8b, 0x68, 0x80, 0xf2, 0x8a, 0x0b, 0xc3, 0x55, 0x10, 0x94, 0xc7, 0x95,
+    0xd5, 0xe2, 0x1d, 0xeb, 0x53, 0x4b, 0xac, 0x2a, 0x42, 0xbe, 0x9c, 0xab, 0x12, 0xa7, 0x42, 0x91,
+    0xd2, 0xe2, 0x3c, 0xa8, 0xe4, 0x39, 0x8a, 0xc9, 0xc9, 0x32, 0x79, 0x50, 0x8e, 0x41, 0xe0, 0x95,
+    0x0f, 0x93, 0xae, 0x81, 0x68, 0x71, 0x71, 0xe1, 0x0f, 0xe0, 0xf5, 0x13, 0x10, 0xa6, 0x25, 0xf0,
+    0x99, 0x30, 0x39, 0xb1, 0x84, 0x4f, 0x8c, 0x82, 0xd1, 0xa6, 0x80, 0xc0, 0xca, 0x0c, 0x4b, 0x6f,
+    0x24, 0xfd, 0x75, 0x4f, 0x91, 0xf9, 0x83, 0x8d, 0x51, 0xc9, 0x90, 0xd2, 0x32, 0x0e, 0xa6, 0xa3,
+    0xac, 0x0c, 0x26, 0x9c, 0xba, 0x71, 0x03, 0xdd, 0xb8, 0x16, 0x13, 0x6f, 0x43, 0x25, 0x06, 0xf6,
+    0x56, 0xa6, 0xf6, 0x0b, 0x06, 0x0a, 0x40, 0xa2, 0x2d, 0xe4, 0x7a, 0xb2, 0x27, 0x5f, 0x90, 0x9f,
+    0xe9, 0x1e, 0x55, 0xb9, 0x3a, 0x6b, 0x2b, 0xe9, 0xcf, 0x4c, 0xf2, 0x38, 0x11, 0x21, 0x15, 0x2d,
+    0xab, 0x10, 0x13, 0xe5, 0x7a, 0x3b, 0x28, 0x6d, 0x30, 0x4c, 0x01, 0x53, 0xc3, 0xeb, 0x0a, 0xaa,
+    0x0d, 0x0a, 0x96, 0x2b, 0x56, 0x2a, 0xbf, 0x76, 0x22, 0xd7, 0x47, 0x6e, 0x13, 0x5a, 0x9b, 0x5b,
+    0x80, 0x8f, 0x47, 0xf4, 0x1b, 0x41, 0xc4, 0xc1, 0x2d, 0xc0, 0x7b, 0x61, 0xda, 0x13, 0x89, 0x83,
+    0x32, 0x37, 0x3f, 0xcc, 0x4f, 0xd3, 0x15, 0xcd, 0x32, 0x31, 0xb2, 0x4d, 0xaa, 0xd8, 0xfc, 0x4f,
+    0xb5, 0x2c, 0x66, 0x7e, 0x21, 0x6c, 0x0d, 0xe7, 0x0b, 0x61, 0x6b, 0xd8, 0xa6, 0x31, 0x64, 0x25,
+    0x7b, 0x85, 0x59, 0xb9, 0x96, 0xea, 0x61, 0xda, 0x50, 0x2b, 0x4a, 0x6b, 0x40, 0x99, 0x8d, 0x52,
+    0xaf, 0x0e, 0xaf, 0xd9, 0x72, 0xfc, 0x26, 0x45, 0xba, 0x49, 0xf9, 0xe4, 0x85, 0xc8, 0x49, 0x36,
+    0xcc, 0x6b, 0x87, 0xde, 0x4d, 0xf4, 0x81, 0xc5, 0x07, 0xfd, 0x30, 0x84, 0x52, 0x5e, 0x0d, 0x3e,
+    0x23, 0x3e, 0xfe, 0x05, 0x83, 0x3a, 0xc5, 0xdf, 0xd6, 0x11, 0x14, 0x9d, 0x0c, 0x76, 0xda, 0x00,
+    0x8d, 0x86, 0x6d, 0xa7, 0x4d, 0x31, 0xed, 0xcf, 0xc1, 0x25, 0xb0, 0xc0, 0x70, 0xd7, 0x30, 0xd4,
+    0xba, 0x37, 0x75, 0xa1, 0x66, 0x76, 0x88, 0xee, 0x23, 0x7d, 0x6b, 0xed, 0x47, 0x5c, 0xd5, 0x78,
+    0x7f, 0x13, 0xed, 0xae, 0x6e, 0xd1, 0x60, 0x4d, 0x0f, 0xcb, 0xba, 0xa6, 0x56, 0x6b, 0xb5, 0x92,
+    0xd1, 0xf9, 0x74, 0x34, 0x8e, 0x3e, 0xfe, 0x77, 0x49, 0xaa, 0x7e, 0x8f, 0xfb, 0x2b, 0x4a, 0xc0,
+    0x00, 0x0f, 0xe1, 0x4b, 0x8d, 0xb5, 0x8b, 0xaf, 0x16, 0x96, 0xd2, 0xa7, 0x59, 0x69, 0x9c, 0x3a,
+    0xbf, 0xca, 0xb3, 0xf3, 0x85, 0xe5, 0x6f, 0xc9, 0x32, 0xfd, 0xbc, 0x13, 0x70, 0x4c, 0x03, 0xfc,
+    0x86, 0x0c, 0x3b, 0x9f, 0x25, 0xe2, 0x80, 0x7a, 0x0d, 0x7f, 0x1b, 0xbe, 0xe9, 0x03, 0x51, 0xe0,
+    0x9b, 0xc6, 0xf1, 0x9b, 0xe6, 0xd8, 0x32, 0x99, 0xc7, 0x4f, 0x9d, 0x85, 0xa5, 0xa7, 0x67, 0xf8,
+    0xf1, 0xd0, 0x27, 0xe8, 0x2a, 0xe2, 0x69, 0x7d, 0xc5, 0x97, 0x5b, 0xdc, 0x58, 0xec, 0xef, 0xdf,
+    0xfe, 0x16, 0x02, 0x3b, 0x39, 0x47, 0x71, 0x89, 0x52, 0x09, 0x8b, 0x7c, 0xd7, 0xdf, 0x40, 0x5c,
+    0x8e, 0x13, 0x62, 0x7d, 0x58, 0x87, 0x83, 0x47, 0x71, 0xce, 0xd7, 0x26, 0xeb, 0x47, 0x6e, 0x3e,
+    0xf2, 0x5e, 0x4e, 0x1e, 0x65, 0xcc, 0x77, 0x57, 0xd7, 0x61, 0x94, 0xd1, 0x7c, 0x6b, 0x32, 0x04,
+    0xc6, 0x9f, 0x90, 0x3a, 0x05, 0x33, 0xca, 0xe6, 0xe8, 0x4f, 0x6a, 0xe6, 0x70, 0x86, 0x21, 0x66,
+    0x7d, 0xb9, 0x3f, 0x9c, 0xd4, 0xf4, 0xc7, 0x69, 0xa3, 0x39, 0x3f, 0x94, 0x5c, 0xa3, 0x35, 0x33,
+    0x51, 0x8c, 0xdc, 0xe3, 0xf8, 0xc8, 0xf9, 0xfc, 0xe5, 0x7e, 0xfe, 0x66, 0x1d, 0x2f, 0xbf, 0x53,
+    0x57, 0x95, 0xc2, 0x1e, 0x76, 0x6f, 0xde, 0xa8, 0xc9, 0x5f, 0x13, 0x43, 0xa5, 0xb1, 0x7f, 0xa1,
+    0xf0, 0x8e, 0x79, 0xb3, 0xaa, 0x35, 0xbb, 0x59, 0x34, 0xad, 0x09, 0xd0, 0x44, 0x00, 0x09, 0x3a,
+    0x62, 0x50, 0x8c, 0xb3, 0x86, 0xd4, 0x3b, 0xbd, 0xa5, 0xf1, 0x33, 0x5f, 0x03, 0xa9, 0xc5, 0xd3,
+    0x0d, 0x14, 0x63, 0x57, 0x2f, 0x95, 0x0d, 0xe1, 0x16, 0xa7, 0xfc, 0xf2, 0xaf, 0x7f, 0xfa, 0xdf,
+    0xff, 0xfe, 0x2b, 0xdd, 0x8b, 0xff, 0xef, 0x3f, 0xff, 0xf2, 0x6f, 0x74, 0x7a, 0xe0, 0x07, 0x6f,
+    0xc9, 0x19, 0xdc, 0x8c, 0xe1, 0xda, 0x46, 0xde, 0x73, 0x29, 0x86, 0xcc, 0x2c, 0x62, 0x55, 0x19,
+    0x3e, 0xed, 0xfe, 0x88, 0x5e, 0xdc, 0x7b, 0x31, 0x2d, 0xb8, 0x4c, 0xa7, 0x68, 0x98, 0x12, 0x79,
+    0x7c, 0xef, 0x44, 0xa6, 0x52, 0xc0, 0xa4, 0x42, 0xb9, 0xe7, 0x8d, 0xaa, 0xa0, 0x90, 0x29, 0x4f,
+    0x6e, 0xb5, 0xb3, 0xe0, 0x0a, 0xce, 0xda, 0x36, 0x75, 0xf0, 0x32, 0x3f, 0x2a, 0xa1, 0xdd, 0xb4,
+    0xa8, 0x45, 0xa2, 0x5a, 0x3d, 0x60, 0xfd, 0x2e, 0x9c, 0x89, 0x52, 0x84, 0x57, 0x82, 0x1b, 0xb1,
+    0xb2, 0xc4, 0x96, 0xc5, 0xe5, 0x9c, 0x2c, 0x54, 0x70, 0xc2, 0x42, 0xc1, 0x60, 0x11, 0x5e, 0x25,
+    0x28, 0xf6, 0xe4, 0xe8, 0x0a, 0x6f, 0xe1, 0x25, 0x3f, 0x81, 0xa7, 0x4e, 0x06, 0xf3, 0x69, 0x98,
+    0x2e, 0x85, 0x6e, 0x95, 0x74, 0x83, 0xa8, 0x0d, 0x4d, 0x3a, 0x3f, 0x2b, 0xe0, 0xa3, 0x42, 0xaf,
+    0x2c, 0x85, 0x9f, 0x0f, 0x65, 0x6a, 0x70, 0xe9, 0x5b, 0xe4, 0x61, 0x5a, 0x60, 0xad, 0x0f, 0x16,
+    0x02, 0x51, 0x54, 0x3e, 0x68, 0xb7, 0xbe, 0xdc, 0x69, 0xf8, 0xce, 0x27, 0x6f, 0xca, 0xff, 0x5d,
+    0x86, 0x8c, 0xfa, 0x04, 0xfe, 0xd4, 0x4e, 0x5b, 0x0b, 0x7f, 0xc9, 0xf4, 0xaf, 0xe2, 0x22, 0xee,
+    0xc6, 0x49, 0x5c, 0x4e, 0xb9, 0x0c, 0xd9, 0x96, 0x84, 0xfe, 0x08, 0x42, 0xa1, 0x0f, 0xe2, 0x28,
+    0x12, 0xa4, 0xe8, 0x5a, 0x2f, 0x16, 0x59, 0xef, 0x3b, 0xb5, 0xd6, 0xbb, 0xf2, 0x59, 0x29, 0x2f,
+    0x0e, 0x70, 0xf8, 0xff, 0x9b, 0x2e, 0x6b, 0xd8, 0x7d, 0x54, 0x00, 0x00
+};
+const size_t DASHBOARD_APP_JS_GZ_LEN = 6204;
+
+#define DASHBOARD_APP_DEBUG_JS_VERSION "b72211eb"
+const uint8_t DASHBOARD_APP_DEBUG_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3c, 0x5d, 0x6f, 0x1c, 0xc9,
+    0x71, 0xef, 0xfc, 0x15, 0x23, 0x5a, 0xd6, 0xcc, 0x1e, 0x97, 0xcb, 0x25, 0x29, 0xe9, 0x74, 0xfc,
+    0xba, 0x48, 0x14, 0x65, 0xed, 0x45, 0x12, 0x15, 0x91, 0xba, 0xb3, 0x41, 0x28, 0xe2, 0xec, 0x4e,
+    0x2f, 0x77, 0x4e, 0xb3, 0x33, 0xeb, 0x99, 0x59, 0x72, 0xf7, 0xe8, 0x05, 0xfc, 0x90, 0x00, 0x41,
+    0x60, 0xc4, 0x80, 0xed, 0x00, 0xce, 0x25, 0x81, 0x13, 0x20, 0x40, 0x92, 0xa7, 0x20, 0x6f, 0x49,
+    0x7e, 0xce, 0xfd, 0x81, 0xf8, 0x27, 0xa4, 0x3e, 0xfa, 0x73, 0x76, 0x76, 0x45, 0xc9, 0x76, 0x60,
+    0x3d, 0x88, 0xd3, 0xdd, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0x55, 0xd5, 0x9b, 0x88, 0xd2,
+    0xbb, 0x2a, 0x76, 0x57, 0x12, 0xf8, 0x1b, 0x17, 0x8f, 0xc3, 0xfc, 0xdd, 0xf3, 0x2c, 0x12, 0xde,
+    0xbe, 0xd7, 0x0f, 0x93, 0x42, 0x70, 0x7d, 0x2e, 0x7a, 0x59, 0x9a, 0x8a, 0x5e, 0xf9, 0xb0, 0x2c,
+    0xc5, 0x70, 0x54, 0x16, 0xd0, 0xdc, 0xde, 0x5d, 0x81, 0xca, 0xa2, 0xf4, 0x86, 0xe1, 0xe4, 0x55,
+    0x4d, 0xfb, 0x3d, 0xd5, 0xde, 0x1b, 0x84, 0x39, 0xd5, 0x5c, 0xcf, 0x9c, 0xaa, 0xd3, 0x78, 0x28,
+    0x2a, 0xd5, 0xe1, 0xa8, 0x1c, 0xe7, 0x95, 0xca, 0x42, 0xe4, 0xb1, 0x28, 0x0e, 0xb3, 0x24, 0xcb,
+    0xdd, 0x86, 0xc3, 0xe3, 0x67, 0xc7, 0xaf, 0x4e, 0xb0, 0x6a, 0xa5, 0x9b, 0x8c, 0xc5, 0x8e, 0xe7,
+    0x7f, 0x6f, 0xbb, 0xfb, 0x60, 0xab, 0x7f, 0xdf, 0x6f, 0x7a, 0x17, 0xb9, 0x10, 0x29, 0xd6, 0x6c,
+    0x6d, 0xf5, 0xee, 0xdd, 0x13, 0x50, 0x93, 0xe5, 0x61, 0x7a, 0x41, 0x40, 0xfd, 0xcf, 0x3e, 0xdd,
+    0xde, 0x44, 0xa0, 0x5c, 0x44, 0x58, 0x16, 0xfd, 0xbb, 0xf0, 0xcf, 0x6f, 0xae, 0x8c, 0xc6, 0xf9,
+    0x28, 0x21, 0x90, 0xf0, 0xc1, 0xbd, 0x7b, 0xfd, 0x4f, 0x01, 0xa4, 0x37, 0x0d, 0x09, 0x4d, 0xfb,
+    0x7e, 0xf7, 0x7e, 0x04, 0x30, 0xde, 0x54, 0x24, 0x49, 0x76, 0x45, 0x68, 0xee, 0x7d, 0x26, 0xda,
+    0x5d, 0x7f, 0x65, 0xc6, 0x2c, 0x4a, 0xc2, 0x69, 0x36, 0x2e, 0xbf, 0x14, 0x79, 0x11, 0x67, 0x29,
+    0x10, 0xb5, 0xbe, 0x69, 0xd7, 0x3f, 0xcb, 0xc2, 0x28, 0x4e, 0x2f, 0x5c, 0xae, 0xf6, 0x92, 0xac,
+    0xf7, 0xee, 0xb8, 0xdf, 0x2f, 0xe0, 0x7b, 0xdf, 0x4b, 0xc7, 0x49, 0x62, 0xd5, 0x9f, 0x4c, 0xd3,
+    0x9e, 0x88, 0x9c, 0xfa, 0x24, 0x2c, 0xca, 0x13, 0xf1, 0x63, 0x5d, 0x27, 0xd9, 0xf0, 0xf0, 0xd5,
+    0xe3, 0xb7, 0x87, 0x4f, 0x1f, 0xbe, 0x3a, 0x85, 0x86, 0xfb, 0x4e, 0xed, 0xf3, 0xd7, 0xcf, 0x4e,
+    0x3b, 0xba, 0xed, 0x53, 0xdd, 0x86, 0x15, 0x6f, 0x0f, 0x8f, 0x9f, 0xbf, 0x7c, 0x75, 0x74, 0x72,
+    0xd2, 0x39, 0x7e, 0xf1, 0xf6, 0x87, 0xc7, 0xaf, 0x00, 0x60, 0xcb, 0x70, 0xf6, 0xc5, 0xe9, 0xab,
+    0xe3, 0x67, 0x6f, 0x4f, 0xbe, 0xea, 0x9c, 0x1e, 0x3e, 0xb5, 0xd7, 0x5a, 0xb5, 0x3c, 0x7a, 0x7d,
+    0x7a, 0x7a, 0xfc, 0x02, 0x5a, 0x36, 0xab, 0x2d, 0x2f, 0x8f, 0xbf, 0x3a, 0x7a, 0x65, 0xda, 0xe7,
+    0x71, 0x3e, 0xeb, 0x3c, 0x3e, 0xc2, 0xd1, 0xb6, 0xab, 0x2d, 0x5f, 0x1c, 0xff, 0xe8, 0xe4, 0xb4,
+    0x73, 0xf8, 0xa7, 0xd0, 0x76, 0x77, 0xae, 0xd7, 0xd1, 0xe9, 0xcb, 0xe3, 0xce, 0x8b, 0x53, 0x5b,
+    0xae, 0x60, 0x02, 0xcf, 0x1f, 0xbe, 0x80, 0x59, 0x3e, 0xfc, 0x41, 0xe7, 0x10, 0x89, 0x9c, 0x3c,
+    0x3e, 0xac, 0xb6, 0x9d, 0x1e, 0xff, 0xe0, 0x07, 0xcf, 0x8e, 0x5c, 0x3a, 0xb9, 0xe5, 0xf0, 0x19,
+    0x0f, 0xb5, 0x55, 0x6d, 0x20, 0x02, 0x5d, 0xfa, 0xe4, 0x38, 0xc7, 0x5f, 0x1e, 0xb9, 0xb4, 0xc9,
+    0x0e, 0x47, 0x0e, 0x59, 0x0f, 0x7f, 0xd8, 0x39, 0x79, 0x7b, 0x72, 0xf8, 0x90, 0x86, 0xdd, 0xde,
+    0xfa, 0xf4, 0xbe, 0xe6, 0x3b, 0xfc, 0x5f, 0xe6, 0x59, 0xf2, 0x34, 0x4c, 0xa3, 0x44, 0x0b, 0x79,
+    0x7f, 0x9c, 0xf6, 0x4a, 0x14, 0x99, 0x48, 0x74, 0xc7, 0x17, 0x41, 0xab, 0xd5, 0x0a, 0xf3, 0x8b,
+    0xa2, 0x01, 0x42, 0x8d, 0x9d, 0xb2, 0x44, 0xb4, 0x92, 0xcc, 0x54, 0xef, 0xae, 0xcc, 0x56, 0xe2,
+    0xbe, 0x17, 0x44, 0x59, 0x6f, 0x3c, 0x14, 0x69, 0xd9, 0xca, 0x45, 0x18, 0x4d, 0x4f, 0xca, 0xb0,
+    0x84, 0x1d, 0xbb, 0xbf, 0xef, 0xf9, 0x09, 0x0b, 0x9a, 0x8f, 0x08, 0x34, 0x50, 0x18, 0x45, 0x47,
+    0x97, 0xf0, 0xf1, 0x2c, 0x2e, 0x4a, 0x91, 0x8a, 0x3c, 0xf0, 0x1f, 0x1f, 0x3f, 0x3f, 0x04, 0x6a,
+    0xb0, 0x0e, 0x3a, 0x88, 0x08, 0x24, 0xbb, 0x28, 0x61, 0x4f, 0x3e, 0x0e, 0x8b, 0x41, 0x37, 0x0b,
+    0xf3, 0x08, 0x47, 0xf2, 0x04, 0x88, 0x2a, 0xe0, 0x71, 0x5b, 0x02, 0x22, 0x42, 0x93, 0x5d, 0x6d,
+    0x04, 0x78, 0xa4, 0xe1, 0x74, 0x20, 0x86, 0x02, 0x41, 0xb1, 0xf0, 0x8c, 0xf6, 0x40, 0xd0, 0x68,
+    0x95, 0x03, 0x91, 0x06, 0x71, 0x1a, 0x97, 0x5f, 0x89, 0xee, 0x09, 0x08, 0xb9, 0x28, 0x5d, 0x64,
+    0x36, 0x30, 0x22, 0xaa, 0xec, 0x9d, 0x32, 0x1f, 0xc3, 0xd6, 0xc9, 0x05, 0x28, 0x89, 0xd4, 0xeb,
+    0x8b, 0xb2, 0x37, 0x08, 0xfc, 0x8d, 0x70, 0x14, 0x6f, 0x30, 0xa0, 0xdf, 0x58, 0xe1, 0x11, 0x40,
+    0x85, 0x8c, 0x80, 0x79, 0xc0, 0x92, 0x03, 0x4f, 0x7d, 0xb7, 0xbe, 0x2e, 0xb2, 0x34, 0x68, 0x18,
+    0x90, 0x34, 0x12, 0x39, 0x8f, 0x05, 0x75, 0xbd, 0x10, 0x91, 0x89, 0x3c, 0xcf, 0x72, 0xec, 0xa4,
+    0x58, 0x4f, 0x15, 0x81, 0xff, 0xdd, 0x3f, 0xfe, 0xcc, 0x3b, 0xa2, 0x36, 0xc9, 0x5e, 0xb9, 0xab,
+    0x77, 0x80, 0x6d, 0x04, 0xa2, 0xd1, 0x02, 0xd9, 0xd0, 0xfd, 0x7a, 0xc1, 0xae, 0xf7, 0x66, 0xee,
+    0x74, 0x6d, 0x22, 0x02, 0xee, 0x42, 0xeb, 0x46, 0x92, 0xe0, 0xff, 0xf6, 0x37, 0xff, 0xfa, 0xef,
+    0xde, 0x2b, 0x02, 0x31, 0x43, 0x7a, 0x97, 0xbe, 0xb7, 0x26, 0xbf, 0x5b, 0x97, 0xac, 0x6d, 0x00,
+    0xa9, 0x5e, 0xea, 0x32, 0x2e, 0x13, 0x54, 0xde, 0x12, 0x82, 0x8a, 0x56, 0xf3, 0x85, 0x28, 0x8f,
+    0x12, 0x81, 0x9f, 0x8f, 0xa6, 0x9d, 0x28, 0xf0, 0x23, 0xb5, 0x70, 0xa7, 0x08, 0xe8, 0xc3, 0x0a,
+    0x89, 0x49, 0x29, 0x25, 0xe3, 0x23, 0xb0, 0x9c, 0x8c, 0xbb, 0xe5, 0x32, 0x44, 0x85, 0x6c, 0x5f,
+    0x82, 0xab, 0x07, 0x68, 0x0a, 0xec, 0x18, 0xc6, 0x20, 0xa9, 0x80, 0x28, 0x86, 0x83, 0x25, 0x7f,
+    0x7a, 0xfa, 0xfc, 0x99, 0x41, 0x43, 0x30, 0xad, 0x61, 0x38, 0x92, 0xcb, 0x78, 0x88, 0x02, 0xdb,
+    0xfa, 0x3a, 0x8b, 0xd3, 0xc0, 0xf7, 0x1b, 0xcb, 0x90, 0xf3, 0x0e, 0x7c, 0x2f, 0x7e, 0x09, 0x66,
+    0x0f, 0xc1, 0x55, 0xf6, 0x28, 0x55, 0x8d, 0xef, 0x2e, 0x4a, 0x65, 0xa1, 0x7f, 0x3c, 0x16, 0xa0,
+    0xbc, 0xd3, 0x70, 0x54, 0x0c, 0x32, 0x16, 0x6e, 0xdc, 0xc6, 0x57, 0x85, 0x77, 0xe7, 0x0e, 0x9c,
+    0xbe, 0xd5, 0x6d, 0xac, 0xb7, 0x47, 0xeb, 0xf8, 0xe5, 0xd1, 0x0b, 0x84, 0x06, 0x98, 0x02, 0x08,
+    0x09, 0xbe, 0x38, 0x39, 0x7e, 0xd1, 0x2a, 0x4a, 0x94, 0x88, 0xb8, 0x3f, 0x0d, 0xae, 0xbd, 0x72,
+    0x3a, 0xc2, 0x23, 0xab, 0x90, 0xa8, 0x7d, 0x90, 0x31, 0x12, 0x32, 0x6b, 0x74, 0x51, 0xc0, 0xc1,
+    0x2a, 0x9e, 0x96, 0xc3, 0x24, 0xc0, 0x55, 0x41, 0x74, 0x72, 0x0f, 0x9d, 0x10, 0x22, 0xae, 0x05,
+    0x1a, 0x46, 0x49, 0xd8, 0x13, 0xc1, 0xc6, 0xd9, 0x9d, 0xbd, 0x83, 0x55, 0xff, 0xcd, 0xc6, 0x05,
+    0x9c, 0x7f, 0x28, 0xce, 0xc1, 0xf5, 0x8a, 0x7f, 0xc7, 0x87, 0x41, 0xee, 0x84, 0xc3, 0xd1, 0x2e,
+    0xc8, 0xbc, 0xbf, 0x47, 0xa5, 0xa4, 0xa4, 0xc2, 0x01, 0x15, 0x2e, 0xb8, 0xb0, 0x4a, 0x85, 0x1f,
+    0x8f, 0x33, 0x2a, 0xae, 0xfa, 0xab, 0x58, 0xfc, 0xde, 0xf6, 0x67, 0xbb, 0x70, 0x50, 0x36, 0xce,
+    0x7a, 0x6f, 0xea, 0x36, 0x00, 0x2e, 0x5f, 0x80, 0x6b, 0xaa, 0xb4, 0x1e, 0x18, 0x22, 0x78, 0xf2,
+    0x59, 0x74, 0x63, 0x6b, 0x2b, 0x46, 0xad, 0xc4, 0xed, 0x03, 0xe0, 0x97, 0x80, 0xad, 0xea, 0x9d,
+    0xaf, 0xec, 0x45, 0xf1, 0x25, 0x1c, 0x99, 0x61, 0x51, 0xec, 0xaf, 0x22, 0xd8, 0x3a, 0xb7, 0xad,
+    0x1e, 0xcc, 0xb7, 0xc4, 0xd0, 0x79, 0xf5, 0xe0, 0xf6, 0xf5, 0x1c, 0x62, 0xa8, 0x6f, 0xcc, 0xf6,
+    0x36, 0x00, 0xbe, 0xae, 0x57, 0xda, 0xcf, 0x10, 0xdb, 0x60, 0xdb, 0xa9, 0x26, 0x41, 0xae, 0xc3,
+    0x46, 0x0d, 0x88, 0x6e, 0xb0, 0x0d, 0xbd, 0x46, 0x4e, 0xa7, 0x08, 0x80, 0xf3, 0x78, 0x84, 0x93,
+    0xaf, 0xeb, 0x6a, 0x35, 0x23, 0x82, 0x11, 0xf4, 0x97, 0x44, 0xd1, 0x9f, 0xf3, 0x5d, 0x92, 0x1a,
+    0x1e, 0x05, 0xd6, 0x9d, 0x64, 0xc5, 0x3a, 0xff, 0x7f, 0xf2, 0x13, 0xaf, 0xa6, 0xcd, 0xb2, 0x02,
+    0x48, 0xa9, 0xa2, 0x25, 0x21, 0x2e, 0x80, 0xf3, 0xc0, 0x3e, 0xdf, 0x5f, 0x88, 0xb2, 0xd2, 0xcd,
+    0x36, 0xc3, 0xce, 0xe4, 0x72, 0xbc, 0x01, 0x0c, 0xf4, 0xc9, 0x8d, 0xb4, 0x5d, 0xf8, 0x13, 0xc5,
+    0x86, 0xed, 0xb3, 0x33, 0xd9, 0xd6, 0xc3, 0x9e, 0x6f, 0x90, 0x44, 0xbb, 0x02, 0xb7, 0x91, 0xa2,
+    0xa5, 0xb2, 0x94, 0x68, 0x22, 0xae, 0x73, 0x23, 0xb2, 0x6a, 0xf1, 0x38, 0xd0, 0xaf, 0x18, 0x85,
+    0xa9, 0xea, 0xc8, 0x5d, 0xd6, 0x63, 0x30, 0x44, 0x57, 0x0f, 0xf6, 0xe2, 0x4a, 0x75, 0x71, 0x85,
+    0x9a, 0xde, 0xeb, 0x5e, 0xac, 0x3b, 0xdc, 0x77, 0x68, 0x9a, 0x41, 0xbf, 0x8d, 0xf8, 0xa0, 0x0e,
+    0x20, 0x09, 0xbb, 0x22, 0xc1, 0xa5, 0xc1, 0x11, 0x0f, 0xce, 0x8d, 0x3a, 0x98, 0x99, 0x25, 0x9a,
+    0xa9, 0xdd, 0xe5, 0x4e, 0x48, 0x2b, 0xc9, 0x75, 0x9c, 0x0a, 0x9b, 0xc0, 0xf4, 0xb9, 0x0a, 0xd2,
+    0xbe, 0xbf, 0x7a, 0xfb, 0x3a, 0x8e, 0x66, 0x6f, 0xa9, 0x0c, 0x23, 0xb3, 0x0c, 0xcf, 0x6a, 0x38,
+    0xd2, 0x53, 0xaa, 0x0b, 0x45, 0xb2, 0x17, 0xa6, 0x97, 0x61, 0x61, 0xf7, 0x47, 0x98, 0xd5, 0x4a,
+    0x0f, 0x02, 0xc2, 0x39, 0xf1, 0x97, 0x92, 0xa6, 0xdb, 0xd7, 0xcc, 0x93, 0xd9, 0xbc, 0xc8, 0xf7,
+    0xb3, 0xac, 0xe4, 0x11, 0x6c, 0xce, 0x52, 0xd3, 0x65, 0x08, 0xb6, 0xb6, 0x87, 0x1a, 0x63, 0x7d,
+    0x5e, 0x7e, 0x15, 0xff, 0x2c, 0x8a, 0x08, 0x7e, 0xf5, 0x60, 0x7d, 0x5d, 0xf2, 0xac, 0x06, 0x25,
+    0x98, 0x10, 0xe5, 0xb8, 0xb0, 0x3b, 0xc9, 0x9a, 0x03, 0xdd, 0xa7, 0xb2, 0x0b, 0x6e, 0xc4, 0xe2,
+    0x1b, 0xf3, 0x95, 0x3a, 0xf0, 0x51, 0x55, 0xa7, 0x35, 0x7e, 0x87, 0x19, 0xd7, 0x2b, 0x94, 0x65,
+    0xf3, 0xb5, 0xe6, 0x69, 0x4f, 0xb7, 0xaa, 0x31, 0xf9, 0x34, 0x0a, 0xe4, 0x41, 0x25, 0xf5, 0xa6,
+    0x65, 0x5c, 0x9e, 0xc9, 0xa2, 0xda, 0xa4, 0xb2, 0x34, 0xa0, 0xd6, 0xdd, 0x45, 0x4a, 0x56, 0xf7,
+    0xd1, 0x7a, 0x56, 0x99, 0x13, 0x35, 0x50, 0xac, 0xe6, 0x14, 0xa0, 0xa5, 0xb9, 0xea, 0xc1, 0x6d,
+    0xd5, 0x26, 0x75, 0x8e, 0x42, 0xa4, 0xd5, 0x4e, 0xcd, 0x15, 0xc2, 0x3a, 0xac, 0x2a, 0xfa, 0x81,
+    0x7b, 0xf3, 0x66, 0x1a, 0x65, 0x57, 0x22, 0x5f, 0x97, 0x55, 0xce, 0xba, 0xcb, 0xaa, 0x83, 0xda,
+    0xbe, 0xe6, 0xa4, 0x00, 0x55, 0x7d, 0xfb, 0x9a, 0x66, 0xa4, 0xf5, 0x36, 0x54, 0x58, 0x34, 0xbb,
+    0xda, 0xd8, 0xc2, 0xc5, 0x43, 0x77, 0xc7, 0x65, 0x99, 0xa5, 0xee, 0xe6, 0xe4, 0xba, 0x3a, 0x38,
+    0x8b, 0xc2, 0x55, 0x2f, 0x4b, 0x7b, 0x49, 0xdc, 0x7b, 0xb7, 0xbf, 0x5a, 0x66, 0x17, 0x17, 0x89,
+    0x50, 0x4b, 0xeb, 0x53, 0xb3, 0xdf, 0x58, 0xad, 0x1b, 0x8e, 0x0f, 0xb2, 0xef, 0xbe, 0xfd, 0x67,
+    0x45, 0x10, 0xed, 0x29, 0x33, 0x6d, 0x14, 0xd6, 0xd5, 0x83, 0xe3, 0x27, 0x4f, 0xcc, 0x06, 0xe2,
+    0x91, 0x97, 0x4c, 0x61, 0xb1, 0x54, 0x32, 0xfa, 0x83, 0x93, 0x29, 0xdc, 0x1e, 0x86, 0x5e, 0x27,
+    0x0d, 0x41, 0x14, 0x2f, 0xc5, 0xe2, 0xbd, 0xb9, 0x74, 0x71, 0xf9, 0x4e, 0x79, 0xa3, 0x65, 0xfd,
+    0x98, 0x85, 0xac, 0x69, 0x34, 0xe7, 0xf7, 0xc7, 0xae, 0xb1, 0xc1, 0x14, 0xc5, 0x70, 0x53, 0xc8,
+    0x72, 0x9b, 0x32, 0x53, 0x59, 0xdd, 0xbe, 0x16, 0x86, 0xe2, 0x2a, 0x86, 0x63, 0xc7, 0x95, 0x0f,
+    0x3a, 0x4b, 0x5c, 0x00, 0xac, 0x8e, 0xd3, 0x11, 0x98, 0xf9, 0xc8, 0x37, 0x54, 0xe0, 0xa2, 0xf7,
+    0xae, 0x9b, 0x4d, 0xdc, 0xf1, 0xa0, 0x9d, 0xc4, 0x66, 0x80, 0x1e, 0x8d, 0x65, 0x72, 0x63, 0x6b,
+    0x5a, 0x49, 0x41, 0x91, 0xc4, 0xc4, 0x29, 0xb3, 0x7a, 0x44, 0xc6, 0x02, 0xe0, 0x85, 0x22, 0xe1,
+    0x88, 0xd6, 0x07, 0xad, 0xff, 0x07, 0x6c, 0xeb, 0xff, 0x87, 0x8d, 0xec, 0xee, 0xd1, 0x90, 0x74,
+    0xac, 0xdc, 0xa4, 0x73, 0x36, 0x82, 0x9a, 0xd2, 0xbc, 0xca, 0xb7, 0x36, 0x31, 0xfd, 0xa9, 0x59,
+    0x8b, 0xa3, 0x89, 0xe8, 0x8d, 0x4b, 0x31, 0xb7, 0x11, 0x6f, 0xb0, 0x61, 0xc8, 0x61, 0xf2, 0xc7,
+    0xc2, 0x30, 0x5b, 0xa6, 0x49, 0x94, 0x5c, 0x99, 0xb6, 0x85, 0x97, 0x1c, 0x6e, 0xab, 0x2e, 0x74,
+    0x8d, 0x20, 0x0f, 0xe3, 0x14, 0x6b, 0xd4, 0xfc, 0xa1, 0x08, 0xfc, 0x1c, 0x86, 0x13, 0xa7, 0x32,
+    0x9c, 0x40, 0x25, 0x1d, 0xac, 0xf3, 0xb0, 0x59, 0x4a, 0x98, 0xe4, 0x10, 0x15, 0xde, 0x37, 0xbd,
+    0x72, 0x10, 0x17, 0x2d, 0xea, 0x5a, 0xd5, 0xa5, 0x72, 0x02, 0xf2, 0xbc, 0x9e, 0x53, 0xa2, 0xb2,
+    0xde, 0x1d, 0xae, 0x56, 0xea, 0x6f, 0xbe, 0x96, 0xd2, 0x8d, 0x65, 0x2e, 0x3a, 0x91, 0xe8, 0xc5,
+    0xc3, 0x30, 0x41, 0x6f, 0x50, 0x20, 0x6f, 0x63, 0xaa, 0x37, 0x68, 0xdb, 0x51, 0xa3, 0x55, 0x8c,
+    0x92, 0xb8, 0x0c, 0xfc, 0x96, 0xdf, 0x38, 0xdb, 0x24, 0xf3, 0x19, 0x8c, 0xcd, 0x56, 0x22, 0xd2,
+    0x8b, 0x72, 0xb0, 0xfb, 0x47, 0x27, 0x11, 0xa2, 0x1c, 0x81, 0x3d, 0x5c, 0x2e, 0x3b, 0x07, 0x35,
+    0x0c, 0x4e, 0xef, 0xfd, 0x7b, 0x4c, 0x6f, 0x2c, 0x04, 0x3f, 0x91, 0x7d, 0xcd, 0xe2, 0xae, 0x6f,
+    0xc2, 0xa2, 0x7e, 0xf7, 0x57, 0xbf, 0xb0, 0xb6, 0x95, 0x2d, 0x82, 0xe9, 0x78, 0xd8, 0x45, 0xa1,
+    0xab, 0x8e, 0x2d, 0x45, 0xef, 0x77, 0x90, 0x45, 0x24, 0xc7, 0xae, 0xa5, 0xd9, 0xe0, 0xea, 0x84,
+    0xe9, 0xd4, 0x87, 0xf6, 0x28, 0x2c, 0xc3, 0x75, 0xb5, 0xb8, 0x08, 0xa8, 0xbe, 0x97, 0xc9, 0xb1,
+    0xd2, 0xe8, 0x40, 0xe7, 0xfc, 0x54, 0x2b, 0x72, 0xfc, 0x87, 0xe4, 0x2a, 0x32, 0x75, 0x6d, 0xde,
+    0x64, 0xb8, 0xa1, 0x90, 0x2b, 0x3f, 0xee, 0x1f, 0xa1, 0xca, 0xfa, 0x3a, 0x03, 0x1b, 0x06, 0x26,
+    0xee, 0x0a, 0x68, 0x1d, 0xc0, 0x28, 0x74, 0x48, 0xa3, 0x22, 0xad, 0x69, 0x1e, 0x96, 0xce, 0xda,
+    0x61, 0x99, 0x38, 0x4a, 0x3c, 0x14, 0x79, 0x94, 0x5d, 0xa5, 0xc8, 0x57, 0xb8, 0x79, 0x7d, 0x21,
+    0x91, 0x19, 0xc6, 0x0a, 0xf4, 0xc2, 0x36, 0x16, 0x8d, 0xf9, 0x2e, 0xcd, 0xba, 0x1f, 0x70, 0xea,
+    0xbc, 0x45, 0xf8, 0xa5, 0x46, 0xc7, 0x8d, 0xf4, 0x5b, 0xbb, 0xd5, 0x6e, 0x37, 0x3d, 0xfc, 0xff,
+    0xbd, 0xba, 0x4d, 0xae, 0x26, 0x3a, 0x0d, 0xac, 0x2b, 0x89, 0xe3, 0xcf, 0x0d, 0x8c, 0x6a, 0x1b,
+    0xe5, 0x59, 0x99, 0x01, 0xd9, 0xa0, 0xda, 0xae, 0xc0, 0x48, 0xca, 0xae, 0x5a, 0x49, 0x06, 0x86,
+    0x12, 0x74, 0x69, 0x99, 0x26, 0xf4, 0x59, 0x0f, 0xca, 0x72, 0x54, 0xec, 0xf8, 0xde, 0xe7, 0x9e,
+    0x7f, 0x55, 0xe0, 0xc7, 0x0e, 0x7e, 0xec, 0xf8, 0xea, 0x6e, 0x71, 0x55, 0xbc, 0xce, 0x11, 0xcb,
+    0xf9, 0xed, 0x6b, 0xd5, 0x71, 0xb6, 0xb1, 0x71, 0xfb, 0xba, 0x8a, 0x75, 0x90, 0x15, 0x65, 0x1a,
+    0x0e, 0xc5, 0x6c, 0xe7, 0xc1, 0x26, 0xd0, 0x2b, 0xdd, 0xa8, 0x87, 0x1c, 0x99, 0x42, 0x17, 0x6a,
+    0x99, 0x19, 0xcf, 0x1a, 0xfa, 0x6e, 0x09, 0x31, 0xdc, 0x46, 0xae, 0x50, 0xfd, 0xa6, 0xe2, 0xca,
+    0xb4, 0x06, 0xa6, 0xa9, 0x95, 0xa5, 0xd9, 0x48, 0xe0, 0xad, 0x46, 0xcd, 0x38, 0xb0, 0x9c, 0xb4,
+    0xdf, 0xfd, 0xc3, 0x5f, 0x9a, 0x5e, 0x9e, 0x8c, 0x82, 0x89, 0x08, 0xfd, 0x83, 0x8b, 0x82, 0x66,
+    0x75, 0x51, 0x9f, 0x4a, 0x64, 0x67, 0x3c, 0x02, 0x59, 0x13, 0x8a, 0xf2, 0x2c, 0x3d, 0x21, 0xb3,
+    0x2b, 0x40, 0xff, 0x37, 0x3a, 0xd0, 0x24, 0x59, 0x43, 0x51, 0x14, 0xe1, 0x85, 0xb0, 0x29, 0x63,
+    0x01, 0x03, 0xf2, 0xca, 0x7c, 0x6a, 0xce, 0x18, 0x90, 0x5b, 0x00, 0x22, 0xd7, 0xe1, 0x28, 0xcc,
+    0x0b, 0xc1, 0x60, 0x2d, 0xac, 0x6f, 0xa8, 0xc1, 0x5e, 0x77, 0x02, 0x59, 0x9e, 0x79, 0xe4, 0x0d,
+    0xf7, 0xd8, 0x1d, 0x6e, 0x47, 0x22, 0xe6, 0xdc, 0xe1, 0x88, 0x0d, 0x19, 0x6b, 0x38, 0x80, 0x38,
+    0x8c, 0x5b, 0x9c, 0x1c, 0x91, 0x92, 0x5a, 0x98, 0x77, 0x21, 0x16, 0x71, 0x11, 0x30, 0x5a, 0x38,
+    0xe2, 0xc2, 0x61, 0xe4, 0x02, 0x6e, 0x90, 0x4f, 0x5d, 0xde, 0x25, 0xe7, 0x79, 0xbd, 0x57, 0x1b,
+    0x97, 0x64, 0x9d, 0x54, 0xa9, 0x5c, 0x5b, 0x33, 0xb7, 0xd8, 0x24, 0x9c, 0x02, 0x8d, 0xcf, 0xc3,
+    0x72, 0x80, 0x5a, 0x39, 0xd8, 0x6c, 0xb7, 0xdb, 0xde, 0x27, 0x5c, 0x86, 0x6b, 0x52, 0xb0, 0xd5,
+    0x9c, 0x8f, 0x85, 0x36, 0x9a, 0xde, 0x36, 0x80, 0xb5, 0x1b, 0x4a, 0xe4, 0xce, 0x7f, 0xfb, 0x9b,
+    0x5f, 0xfd, 0x85, 0xa7, 0xc7, 0x46, 0x06, 0xc5, 0xa9, 0x87, 0x1a, 0x0a, 0xb0, 0xcf, 0x86, 0x85,
+    0x17, 0x84, 0xdc, 0x15, 0xea, 0xe6, 0xb0, 0xcd, 0x40, 0xb0, 0xeb, 0x28, 0x9f, 0x35, 0xce, 0x61,
+    0x00, 0x10, 0x1a, 0x0c, 0x9b, 0x62, 0xbc, 0xc0, 0xd9, 0x76, 0x4d, 0x26, 0xdd, 0x8e, 0xda, 0x58,
+    0xac, 0x7d, 0x1e, 0x4e, 0x0c, 0xd9, 0xb8, 0x65, 0x43, 0xc5, 0xa5, 0x5c, 0x84, 0x70, 0xc7, 0x20,
+    0x2e, 0x9b, 0x95, 0x92, 0x61, 0x10, 0x4b, 0xaa, 0x96, 0x08, 0x82, 0x59, 0x36, 0xaa, 0x74, 0xd6,
+    0xde, 0x51, 0x13, 0xae, 0x98, 0xd9, 0x61, 0x8e, 0x5f, 0xfe, 0xb5, 0xf7, 0x1a, 0x1b, 0x91, 0x51,
+    0xaf, 0x3b, 0xa0, 0x2c, 0xca, 0x81, 0x96, 0x23, 0x29, 0x93, 0x14, 0xf3, 0x82, 0xcf, 0x96, 0x89,
+    0x92, 0x84, 0xa3, 0x51, 0x32, 0xe5, 0xd8, 0xc9, 0x21, 0x9d, 0x9b, 0x0e, 0x80, 0xb2, 0x8d, 0x74,
+    0xc0, 0x0c, 0xdb, 0x64, 0x7c, 0x99, 0xdc, 0x99, 0x83, 0xec, 0xea, 0x90, 0x8b, 0x6e, 0x5b, 0x6d,
+    0x47, 0xd7, 0xd5, 0x7f, 0x0b, 0x94, 0xd6, 0x38, 0x8d, 0x44, 0x1f, 0x0e, 0x90, 0x08, 0x1d, 0xf8,
+    0x0b, 0x60, 0x9c, 0x1a, 0xe5, 0xf2, 0xbf, 0xe5, 0x84, 0x86, 0x1c, 0x3e, 0x80, 0xd0, 0xf0, 0x7c,
+    0x3c, 0x36, 0x04, 0x22, 0x14, 0x36, 0x37, 0xe2, 0xe4, 0xd7, 0x46, 0xd4, 0x2a, 0xe1, 0x85, 0x86,
+    0xd1, 0xd5, 0xce, 0x2c, 0x0a, 0xd0, 0x30, 0x0e, 0xed, 0x8a, 0x26, 0xa5, 0x7e, 0xb0, 0x11, 0x15,
+    0x90, 0x9e, 0x13, 0xf6, 0x38, 0xd0, 0x71, 0xe7, 0x35, 0x30, 0x0c, 0x34, 0xbd, 0xe7, 0xdf, 0x7d,
+    0xfb, 0x4f, 0xff, 0xfb, 0x5f, 0x3f, 0xf7, 0x9e, 0xc7, 0x45, 0x01, 0x5c, 0xe8, 0xe7, 0x21, 0x46,
+    0xf3, 0x6f, 0x5f, 0x5b, 0xc0, 0xb3, 0x56, 0x0b, 0x84, 0x5e, 0xe1, 0x59, 0x87, 0x8a, 0xa6, 0x8a,
+    0x84, 0xe0, 0x8c, 0x54, 0xc8, 0xe2, 0x9c, 0x78, 0x5e, 0x09, 0x90, 0x20, 0xe1, 0x46, 0x2b, 0x2a,
+    0x24, 0x58, 0x5b, 0xe6, 0x21, 0xdc, 0xb0, 0x50, 0x89, 0x06, 0x55, 0xe1, 0xd0, 0x5a, 0xe3, 0x30,
+    0x89, 0x41, 0xc1, 0x15, 0xf3, 0xb3, 0x95, 0x81, 0x58, 0x6a, 0x3e, 0xcc, 0xc6, 0x69, 0x79, 0x84,
+    0x07, 0xcb, 0xe2, 0x78, 0x91, 0x01, 0xf4, 0x95, 0xd7, 0xca, 0xee, 0x4b, 0x28, 0xed, 0x8a, 0x4a,
+    0xd8, 0xab, 0x96, 0x2a, 0x8e, 0xce, 0x58, 0x42, 0x99, 0x47, 0xa4, 0x97, 0x4c, 0xa9, 0xd5, 0xcf,
+    0xf2, 0x23, 0xd8, 0x98, 0xe4, 0x62, 0xa4, 0x80, 0xa2, 0x24, 0x9c, 0x8e, 0xec, 0xa5, 0x24, 0x4b,
+    0xcf, 0x3c, 0xb0, 0xdf, 0xe7, 0x03, 0xde, 0xd7, 0x2e, 0x3a, 0xbe, 0xbb, 0xdf, 0xb8, 0x37, 0x83,
+    0xab, 0x69, 0xcb, 0x91, 0x91, 0x4e, 0xf9, 0x59, 0x99, 0x2a, 0x75, 0xa5, 0x26, 0x4b, 0x0d, 0xaa,
+    0x9d, 0x0d, 0x02, 0x22, 0x3d, 0xf8, 0x60, 0x78, 0xf0, 0x2c, 0x76, 0x54, 0x0d, 0x95, 0x66, 0xe7,
+    0x3a, 0xb4, 0xad, 0xc9, 0x04, 0x21, 0xbc, 0xa5, 0x32, 0x42, 0x74, 0xc4, 0xa1, 0xc1, 0xf1, 0x68,
+    0x82, 0xa8, 0xa3, 0x80, 0xdb, 0xb4, 0x8d, 0x8a, 0x55, 0x22, 0xed, 0x99, 0xa5, 0xef, 0xa2, 0xe0,
+    0x20, 0x07, 0x40, 0x1d, 0xc2, 0x65, 0x11, 0x1d, 0xe4, 0x8f, 0x48, 0x96, 0x7a, 0x1c, 0xf4, 0x5e,
+    0x16, 0x5f, 0x21, 0x2c, 0xe4, 0xf4, 0x1d, 0x50, 0xcc, 0x9b, 0x4e, 0x55, 0x42, 0xd8, 0x2a, 0x29,
+    0x26, 0x11, 0x94, 0x98, 0xd2, 0x52, 0x86, 0xc3, 0x51, 0xd3, 0x8b, 0x1b, 0x1c, 0x3a, 0xf3, 0x74,
+    0xdd, 0x8e, 0x67, 0x35, 0x4b, 0x1e, 0x70, 0x6f, 0x0e, 0x2e, 0x9c, 0xb5, 0xdf, 0x9c, 0xc5, 0x6f,
+    0x64, 0xfc, 0x4e, 0x69, 0x71, 0x2b, 0xec, 0xa1, 0x07, 0xe3, 0xe2, 0x2e, 0xb7, 0x95, 0x86, 0x06,
+    0x23, 0x58, 0x0b, 0x23, 0x44, 0xc0, 0x53, 0x77, 0x06, 0x38, 0x27, 0x79, 0xbe, 0x62, 0x95, 0x92,
+    0x80, 0x66, 0x15, 0x6c, 0x77, 0x31, 0x66, 0x3b, 0xcb, 0x44, 0xe1, 0x67, 0x12, 0x0d, 0xf2, 0xe7,
+    0xe3, 0xa4, 0x8c, 0xeb, 0x46, 0x60, 0x40, 0x59, 0x60, 0xcd, 0x35, 0x6b, 0xb8, 0x4a, 0x5b, 0x06,
+    0x63, 0xcd, 0x16, 0x51, 0xd1, 0x59, 0xbd, 0x4b, 0xb8, 0x82, 0x37, 0x8a, 0x36, 0x16, 0xb0, 0x0a,
+    0x4e, 0x1b, 0xe3, 0xd4, 0x6e, 0x7a, 0xe6, 0xb2, 0x06, 0x20, 0xa6, 0xc8, 0x97, 0xaa, 0x5d, 0x39,
+    0xb0, 0x75, 0x64, 0x55, 0x55, 0x8d, 0x54, 0x97, 0x44, 0x85, 0x5e, 0x4b, 0x62, 0x84, 0xa5, 0x64,
+    0x94, 0xe2, 0x35, 0x6a, 0x97, 0x33, 0x79, 0x50, 0x17, 0x59, 0x99, 0x3d, 0xac, 0x3a, 0xec, 0x44,
+    0x1f, 0x0b, 0xb8, 0xde, 0x4a, 0x9c, 0x49, 0x19, 0xce, 0x54, 0x35, 0xac, 0x8c, 0x68, 0xa5, 0x60,
+    0x96, 0x34, 0x40, 0xbb, 0xba, 0x54, 0x29, 0x65, 0x65, 0x61, 0x51, 0xca, 0x1d, 0x6e, 0xa9, 0x12,
+    0xc3, 0x9e, 0x9d, 0x82, 0xa4, 0x09, 0xd2, 0xa3, 0x32, 0x94, 0xb5, 0x9d, 0xff, 0xf6, 0x17, 0x1e,
+    0x71, 0x43, 0xf5, 0xbf, 0x7d, 0xcd, 0x1f, 0x33, 0x0f, 0x8d, 0x9a, 0x48, 0x5c, 0xc6, 0x3d, 0x81,
+    0xdb, 0xda, 0x9a, 0x16, 0xd8, 0xf4, 0x3c, 0x25, 0xb2, 0xea, 0xc9, 0x0c, 0x40, 0x1a, 0x7d, 0x36,
+    0x67, 0x1c, 0x6e, 0x73, 0x7f, 0x34, 0x6f, 0xcc, 0x3e, 0xb2, 0xee, 0x90, 0x68, 0x9f, 0xe3, 0x84,
+    0x03, 0x1b, 0x3d, 0x46, 0x3c, 0xeb, 0xe6, 0xf8, 0xb9, 0xd9, 0x6b, 0x9e, 0xb5, 0xef, 0x40, 0xb1,
+    0xd9, 0x33, 0x76, 0xec, 0x13, 0x90, 0xa6, 0x61, 0x58, 0x2e, 0x1c, 0xbe, 0x96, 0xba, 0x56, 0x99,
+    0x3d, 0x83, 0xdb, 0x47, 0x42, 0xf5, 0xd2, 0x7d, 0x73, 0xf6, 0xa6, 0xe9, 0x5d, 0x7b, 0x83, 0x6c,
+    0x9c, 0x6f, 0x6e, 0xed, 0x70, 0xe2, 0x47, 0x35, 0xef, 0x63, 0xde, 0x74, 0xe1, 0x03, 0xdf, 0x3a,
+    0x5d, 0x29, 0xf9, 0x43, 0x5a, 0x03, 0xc0, 0x51, 0x6a, 0x6e, 0x65, 0xa3, 0x99, 0x29, 0xbc, 0x83,
+    0xdb, 0xcf, 0x6c, 0xc7, 0x94, 0x41, 0xb3, 0x9e, 0x4b, 0x05, 0xe6, 0x66, 0x9f, 0x20, 0x8f, 0x18,
+    0xe4, 0x72, 0x91, 0x71, 0xa2, 0x8e, 0xf6, 0x7a, 0x03, 0xe5, 0x43, 0x0d, 0x0e, 0x96, 0x52, 0x31,
+    0x89, 0xf9, 0x9c, 0x5f, 0x72, 0xdc, 0x28, 0xca, 0xe9, 0xc0, 0xc1, 0xc4, 0x16, 0x6b, 0x6e, 0x4a,
+    0x19, 0xab, 0xa9, 0xf3, 0x5d, 0x31, 0x17, 0xc3, 0xec, 0x52, 0xf8, 0x8a, 0x58, 0x35, 0x08, 0x96,
+    0xd5, 0x77, 0x8b, 0x61, 0xd8, 0x86, 0x30, 0x8a, 0x94, 0xf3, 0x06, 0xe0, 0x4a, 0x8d, 0x47, 0x85,
+    0x19, 0x86, 0xd1, 0xa2, 0xfa, 0xc1, 0x0b, 0xa8, 0x9d, 0x90, 0xc0, 0x30, 0x57, 0x71, 0x74, 0x81,
+    0x9b, 0x63, 0xa7, 0x1a, 0x7a, 0x73, 0x9a, 0x77, 0x17, 0x53, 0x03, 0x6c, 0xd3, 0xf9, 0x25, 0x38,
+    0xfc, 0x6e, 0x95, 0x26, 0xed, 0x8b, 0xe8, 0x44, 0xcb, 0x48, 0xab, 0x66, 0xc6, 0xe0, 0x7e, 0x9a,
+    0xcf, 0x67, 0x59, 0x9c, 0xfc, 0x62, 0x0d, 0x83, 0x49, 0x2f, 0xa0, 0x78, 0xcb, 0x87, 0xd1, 0xd7,
+    0x61, 0x0f, 0xda, 0x91, 0xba, 0xc0, 0xef, 0x0a, 0xd8, 0x02, 0x02, 0x26, 0x09, 0x66, 0x37, 0x12,
+    0x2a, 0xf7, 0x67, 0x35, 0xcd, 0xc5, 0x95, 0xa5, 0x1a, 0x13, 0xdf, 0xa8, 0xf9, 0x0e, 0xea, 0x5c,
+    0xfb, 0xa4, 0xe1, 0x54, 0xd0, 0x33, 0x6e, 0xc3, 0xc0, 0xe4, 0xd9, 0x35, 0x9f, 0x84, 0xc5, 0x8e,
+    0x01, 0xa4, 0xa3, 0x94, 0xbc, 0x29, 0xa8, 0xd1, 0xe9, 0x43, 0xaa, 0x68, 0x54, 0xd9, 0x09, 0xdc,
+    0x31, 0x64, 0x6a, 0x41, 0x0b, 0xd3, 0x3e, 0xbd, 0xd9, 0x9b, 0xdd, 0x15, 0x93, 0x4f, 0x6a, 0xe1,
+    0x5e, 0x8a, 0xd0, 0xec, 0x61, 0x75, 0xe6, 0x5b, 0x86, 0x46, 0x07, 0xed, 0x0c, 0x25, 0xcf, 0x51,
+    0x1e, 0x5e, 0xd5, 0x4c, 0x49, 0x43, 0x36, 0xbd, 0xf9, 0xd1, 0x1b, 0x35, 0x6c, 0xa9, 0x1c, 0x81,
+    0x88, 0x48, 0x1d, 0x7e, 0x44, 0x8c, 0x65, 0x9e, 0xaa, 0x5c, 0xd7, 0xb9, 0x9c, 0x0b, 0x9c, 0x18,
+    0x6c, 0xe7, 0x33, 0x35, 0x65, 0x7b, 0xba, 0x56, 0x6e, 0x04, 0x5b, 0x6b, 0x80, 0x18, 0x84, 0x48,
+    0x4c, 0x94, 0x21, 0xa2, 0x18, 0xad, 0x1a, 0x25, 0x2f, 0x79, 0xb4, 0x33, 0x02, 0x25, 0xec, 0x0e,
+    0x73, 0xd1, 0x18, 0xa9, 0xe5, 0x2e, 0xd1, 0x7c, 0x13, 0xee, 0xf0, 0xe4, 0x1c, 0x86, 0xcc, 0x77,
+    0x62, 0xe2, 0x31, 0x3f, 0x71, 0x9e, 0x1b, 0x9c, 0xe3, 0xb0, 0xdc, 0x68, 0xed, 0xb0, 0x0a, 0xa1,
+    0xb1, 0x95, 0xc9, 0x7a, 0x8b, 0x7b, 0x9a, 0x95, 0x94, 0xf8, 0xca, 0x09, 0x19, 0x8b, 0xd8, 0x86,
+    0xa8, 0xc8, 0x80, 0x9c, 0x94, 0x81, 0xbf, 0x15, 0x19, 0x5b, 0x19, 0x6e, 0xcb, 0xa5, 0x03, 0xf5,
+    0x08, 0xec, 0x7b, 0xd4, 0x87, 0x6c, 0xc3, 0xc3, 0xed, 0x9c, 0xee, 0x28, 0xb2, 0x1d, 0x94, 0x00,
+    0x5c, 0x59, 0xf7, 0xa9, 0x17, 0x17, 0x74, 0xd3, 0x40, 0xc4, 0x17, 0x83, 0x52, 0xb5, 0x71, 0x09,
+    0x1a, 0xcb, 0x49, 0xab, 0x97, 0x88, 0x30, 0x27, 0x44, 0xe8, 0x7e, 0x6b, 0x7a, 0x36, 0x2e, 0x5d,
+    0xe2, 0x0e, 0x9a, 0x2c, 0xf6, 0xfb, 0xeb, 0xc5, 0x46, 0x7e, 0xc9, 0x58, 0x00, 0x28, 0x08, 0x53,
+    0x07, 0x96, 0x24, 0xef, 0x98, 0x42, 0xb5, 0xee, 0xa0, 0xe7, 0x89, 0x8e, 0x06, 0x2e, 0xef, 0x79,
+    0x5b, 0x86, 0x2f, 0x98, 0x11, 0x34, 0x8c, 0xd3, 0x2f, 0x29, 0xcf, 0x61, 0xdf, 0xeb, 0xa4, 0x7d,
+    0xf4, 0x2d, 0x4c, 0x65, 0x43, 0x38, 0x51, 0x0d, 0xeb, 0xa6, 0x05, 0x34, 0x05, 0x79, 0x80, 0x75,
+    0x7e, 0x36, 0x98, 0x04, 0x16, 0x01, 0xb8, 0x7a, 0x16, 0x08, 0x67, 0x50, 0x68, 0x08, 0x49, 0x9b,
+    0xd2, 0xe1, 0xdc, 0xaa, 0x8e, 0xee, 0x06, 0xe9, 0xc3, 0x38, 0xc5, 0x7b, 0x84, 0x69, 0xdd, 0xd3,
+    0x04, 0x36, 0x6c, 0x52, 0xe5, 0x7d, 0xc3, 0xc0, 0x1d, 0x68, 0x7a, 0x1b, 0x36, 0xe5, 0x12, 0x4e,
+    0x99, 0xc7, 0x06, 0xc3, 0xbe, 0x99, 0x6e, 0x55, 0x4e, 0x28, 0x7c, 0x05, 0x7d, 0x35, 0x9a, 0x75,
+    0x33, 0x32, 0xec, 0x12, 0x9d, 0x50, 0x3c, 0x0a, 0x23, 0x99, 0xe4, 0xb9, 0xd5, 0x76, 0xf2, 0xdb,
+    0xbf, 0x92, 0x52, 0xe1, 0x08, 0xc9, 0xba, 0xb7, 0xe5, 0x7d, 0xa2, 0xfa, 0x38, 0xe0, 0x4f, 0x95,
+    0xa4, 0xb8, 0x92, 0x53, 0xdb, 0x61, 0x72, 0xdc, 0x07, 0x40, 0xda, 0xb2, 0xa4, 0xd2, 0x24, 0x09,
+    0x6b, 0x74, 0x5c, 0xaa, 0x91, 0x37, 0xf4, 0x6a, 0xc3, 0xd5, 0xbb, 0xd1, 0x00, 0x2c, 0xd4, 0x41,
+    0xe1, 0x98, 0x12, 0x0e, 0xc9, 0x7c, 0x1b, 0x87, 0x4d, 0xcd, 0xba, 0x27, 0x95, 0x89, 0x35, 0xfb,
+    0x06, 0x60, 0xce, 0xd9, 0x5c, 0xf9, 0xc4, 0x06, 0x66, 0xb1, 0x2e, 0xe0, 0x40, 0x7a, 0x07, 0xb6,
+    0xd0, 0x94, 0xf2, 0x46, 0xac, 0x07, 0x05, 0x9f, 0x63, 0x7e, 0xfe, 0xf6, 0xdd, 0xcd, 0x7b, 0xf7,
+    0xe8, 0xe8, 0xfa, 0x9e, 0xd8, 0x12, 0x0f, 0xfa, 0x6d, 0x9f, 0x7b, 0x25, 0x70, 0x30, 0x29, 0x7e,
+    0x6d, 0x4a, 0xf1, 0xa2, 0x07, 0x09, 0xe4, 0x33, 0x85, 0x3f, 0x7b, 0x98, 0x78, 0xed, 0xc5, 0x6b,
+    0x6b, 0x46, 0x31, 0xa0, 0xa3, 0xae, 0x3a, 0x73, 0x49, 0xf6, 0x86, 0x77, 0x97, 0xe6, 0xcb, 0xc8,
+    0xbb, 0xe2, 0x22, 0x4e, 0x5f, 0x86, 0xe5, 0x80, 0xb6, 0x2c, 0x54, 0xa0, 0x79, 0x70, 0x9a, 0x05,
+    0xb2, 0x73, 0xd3, 0x9b, 0x36, 0x0c, 0x15, 0x50, 0x5f, 0x59, 0xb0, 0x39, 0x30, 0x9e, 0x62, 0xa0,
+    0xaf, 0x29, 0xa4, 0xb0, 0xf0, 0xea, 0x43, 0x1f, 0x6a, 0xcb, 0xa1, 0x6c, 0xf1, 0x27, 0x91, 0x0c,
+    0xfd, 0xfa, 0x71, 0x92, 0x2c, 0x60, 0xcc, 0x67, 0x77, 0xc3, 0xed, 0xee, 0x03, 0x66, 0xcc, 0xfd,
+    0xbb, 0x9f, 0xde, 0x7d, 0xd0, 0x95, 0x8c, 0xe9, 0x67, 0x74, 0xb7, 0xf5, 0x37, 0xdb, 0xa3, 0x89,
+    0x57, 0x84, 0x69, 0xb1, 0x8e, 0x7b, 0xa8, 0x2f, 0x5b, 0x51, 0x71, 0x3d, 0x0a, 0x0b, 0x81, 0x84,
+    0x23, 0x54, 0x37, 0x2b, 0xcb, 0x6c, 0x68, 0x35, 0x3e, 0x4c, 0xe2, 0x0b, 0x3c, 0xb4, 0xfd, 0x44,
+    0xf4, 0x4b, 0x85, 0x12, 0xc8, 0x38, 0x45, 0x8d, 0x57, 0xb5, 0x78, 0x41, 0x6d, 0xc0, 0x11, 0xab,
+    0xa7, 0x3b, 0xa7, 0x82, 0xaa, 0x38, 0x73, 0x6c, 0x78, 0x2f, 0x52, 0x23, 0x83, 0x88, 0x7d, 0x11,
+    0x6f, 0xab, 0x83, 0xcd, 0x56, 0x2c, 0x15, 0xa7, 0x2e, 0x7a, 0x26, 0xe7, 0xef, 0xba, 0x46, 0xd6,
+    0xec, 0x1c, 0xbe, 0x79, 0xa9, 0x92, 0x64, 0x1c, 0xc0, 0x2e, 0x6d, 0x03, 0xcb, 0x37, 0x81, 0xd5,
+    0x5b, 0x35, 0xe2, 0x81, 0x42, 0x87, 0xc7, 0x93, 0xf3, 0x58, 0xc3, 0x51, 0x5b, 0x9a, 0x1a, 0xde,
+    0x18, 0xf6, 0x21, 0x5b, 0xaf, 0xcf, 0xae, 0x57, 0xe6, 0x10, 0x4a, 0x0b, 0x90, 0x4e, 0x29, 0xd9,
+    0xa8, 0x84, 0x44, 0xca, 0x26, 0xec, 0xf0, 0x80, 0x11, 0x37, 0x71, 0xa7, 0x32, 0x52, 0x3c, 0x8c,
+    0x0d, 0x2e, 0xce, 0x86, 0x37, 0xc6, 0xa4, 0x11, 0xe0, 0x85, 0x9d, 0xf9, 0x72, 0xed, 0xca, 0xb0,
+    0x75, 0x2a, 0x1c, 0x78, 0x9b, 0xed, 0xb6, 0xa5, 0x07, 0x2b, 0x32, 0xeb, 0x32, 0xf8, 0x77, 0x63,
+    0x8a, 0x3d, 0xc6, 0xdc, 0xfe, 0x0c, 0xf3, 0xde, 0x82, 0x39, 0x34, 0xbd, 0x6d, 0x3a, 0x2c, 0xb7,
+    0x94, 0x53, 0xfe, 0x65, 0xa7, 0x61, 0x08, 0x0d, 0xd4, 0x25, 0xbe, 0xf2, 0x44, 0xc1, 0xf2, 0xf5,
+    0x5a, 0x2e, 0x60, 0xe5, 0xc7, 0xfc, 0xf9, 0xff, 0x78, 0xb2, 0x15, 0xef, 0x80, 0xe4, 0x96, 0xa2,
+    0x12, 0xde, 0xa8, 0x76, 0xac, 0x62, 0x0f, 0x5d, 0x7c, 0x33, 0xd8, 0x84, 0xc3, 0x11, 0x3e, 0xdf,
+    0xf8, 0x13, 0xab, 0x89, 0x82, 0x80, 0xde, 0xd3, 0x6f, 0xce, 0xf5, 0x49, 0xcd, 0x6c, 0xd1, 0x8e,
+    0xa6, 0x3f, 0x1b, 0x87, 0x70, 0xa8, 0x7d, 0x23, 0xa2, 0xc7, 0x22, 0x29, 0xc3, 0x42, 0x91, 0x41,
+    0x21, 0x98, 0xa6, 0xe7, 0x8c, 0x60, 0x8a, 0x7c, 0xb9, 0x36, 0xe5, 0x02, 0x6f, 0x9a, 0x64, 0x75,
+    0x68, 0x5b, 0x55, 0x11, 0x5a, 0xb1, 0xa5, 0x2b, 0x26, 0x5e, 0xd5, 0x5c, 0xb6, 0xed, 0x2f, 0x85,
+    0x41, 0x0f, 0xe3, 0xa0, 0xfd, 0x30, 0xe7, 0xa1, 0xea, 0x56, 0xe3, 0x3f, 0x54, 0xfd, 0xad, 0xcc,
+    0x87, 0x71, 0x1e, 0xca, 0x74, 0xc1, 0xc0, 0x61, 0x00, 0x68, 0x6f, 0x9b, 0xaf, 0xb0, 0xd2, 0x18,
+    0x85, 0xc1, 0xbb, 0xf6, 0x93, 0x78, 0x22, 0xa2, 0x60, 0x13, 0xe3, 0x20, 0xf5, 0x2e, 0x40, 0x5a,
+    0xcc, 0x0f, 0x5a, 0x31, 0x2f, 0xb8, 0x7d, 0xad, 0x28, 0x41, 0x37, 0x46, 0xe3, 0xdc, 0x5b, 0x5b,
+    0x31, 0xcb, 0x93, 0x67, 0xa3, 0x11, 0x79, 0x31, 0xce, 0x9b, 0x56, 0x67, 0x59, 0x3d, 0xf3, 0xe4,
+    0xc7, 0x39, 0xea, 0x6d, 0xb8, 0x93, 0xc2, 0xb4, 0x41, 0xa7, 0x51, 0x68, 0x9d, 0x0f, 0x46, 0x12,
+    0xa8, 0x24, 0xbe, 0x14, 0xde, 0x65, 0x2c, 0xae, 0x7c, 0x73, 0x39, 0xbe, 0x81, 0x51, 0xeb, 0x30,
+    0xd3, 0x31, 0x6c, 0x95, 0x5d, 0x7b, 0xad, 0x8c, 0x4c, 0x19, 0xce, 0x47, 0x4e, 0xca, 0x2d, 0x17,
+    0x09, 0x50, 0x64, 0xa2, 0x76, 0x49, 0x77, 0xe7, 0x7b, 0xb1, 0x7b, 0x69, 0x81, 0x54, 0x28, 0x73,
+    0xde, 0x88, 0x1a, 0xdd, 0x40, 0x2a, 0xd7, 0x1e, 0x5b, 0x62, 0x66, 0x15, 0xc7, 0x4e, 0x17, 0x4e,
+    0xa8, 0xfb, 0x77, 0x4f, 0xb3, 0x47, 0xd3, 0x52, 0x14, 0xfa, 0x09, 0x82, 0xf4, 0xc7, 0xc6, 0x69,
+    0x98, 0xe3, 0x49, 0x1e, 0x96, 0x59, 0x97, 0xdb, 0x94, 0xc8, 0x75, 0x11, 0x5c, 0x06, 0x66, 0x5f,
+    0xc3, 0x9d, 0xed, 0xc1, 0xc3, 0x3c, 0x0f, 0xa7, 0x01, 0xf7, 0x90, 0xa7, 0x6c, 0xa3, 0xd6, 0x56,
+    0xf0, 0x1c, 0x18, 0x6d, 0x36, 0x10, 0x42, 0x74, 0xb1, 0xee, 0x2b, 0x00, 0x9c, 0xc2, 0x21, 0x6c,
+    0xcf, 0x87, 0x65, 0x10, 0x5b, 0x4e, 0x0c, 0x1e, 0xda, 0xd1, 0x21, 0x97, 0x61, 0x1e, 0xa3, 0xdd,
+    0x8f, 0x39, 0x08, 0x01, 0x35, 0xab, 0x5c, 0xfa, 0x51, 0x26, 0x03, 0xbb, 0xb2, 0xaf, 0x5a, 0x02,
+    0x6c, 0x93, 0x5a, 0x0f, 0x5b, 0xb1, 0x58, 0x0c, 0xe2, 0x7e, 0xc9, 0x16, 0x0e, 0x16, 0x11, 0x0d,
+    0xde, 0xd7, 0x25, 0x69, 0x48, 0x16, 0x51, 0x08, 0x18, 0xd7, 0xd6, 0x60, 0x9d, 0xb8, 0xf7, 0x1a,
+    0xac, 0x2a, 0x35, 0xdf, 0xf1, 0xda, 0x93, 0x4f, 0xfb, 0x68, 0xd7, 0x10, 0x1e, 0xd8, 0x04, 0x84,
+    0xee, 0x13, 0xc0, 0xb7, 0xf5, 0x00, 0x0f, 0x82, 0xab, 0x41, 0x0c, 0x7a, 0xda, 0x00, 0x3f, 0x68,
+    0xeb, 0x68, 0x96, 0xb6, 0x80, 0xdd, 0x8b, 0x69, 0xfa, 0x4d, 0x7c, 0xf1, 0x4d, 0x78, 0x11, 0xc0,
+    0xca, 0x5b, 0xae, 0x2e, 0x28, 0x79, 0xdf, 0x07, 0x15, 0xfb, 0xb9, 0xb7, 0x8e, 0x2d, 0xec, 0x1c,
+    0xda, 0x80, 0x8a, 0x1d, 0x6a, 0xda, 0xc0, 0x83, 0xd3, 0xf1, 0xdb, 0xd5, 0x69, 0x38, 0x5c, 0x4a,
+    0x54, 0x40, 0xa4, 0xd1, 0x94, 0x26, 0x63, 0x0d, 0xa6, 0x17, 0x1f, 0x5f, 0xbd, 0x7c, 0x49, 0x8c,
+    0x25, 0x4b, 0xd4, 0xe6, 0xf0, 0xbc, 0xc8, 0xcc, 0xab, 0x56, 0x14, 0x0c, 0x96, 0x09, 0x1a, 0x46,
+    0x9e, 0xde, 0x94, 0x01, 0x43, 0x2c, 0xaf, 0x93, 0x0c, 0x82, 0xac, 0x18, 0x92, 0x38, 0xa9, 0x7d,
+    0x8b, 0x18, 0x75, 0x2a, 0x52, 0x3d, 0x9c, 0x58, 0x6d, 0x1d, 0xf5, 0x90, 0xd2, 0xa3, 0x9f, 0x5f,
+    0xca, 0x7b, 0x0a, 0x18, 0x2b, 0x38, 0xe8, 0xda, 0xbe, 0xc3, 0x51, 0x32, 0xbb, 0x77, 0x9d, 0x8e,
+    0xd2, 0x6f, 0xba, 0xc6, 0x44, 0x7e, 0xc2, 0xfc, 0xb0, 0xe4, 0x8e, 0x61, 0x6b, 0xb8, 0x5b, 0x0d,
+    0x54, 0x7c, 0x30, 0x0b, 0xf9, 0x79, 0x09, 0xba, 0x61, 0x8c, 0x4a, 0xc7, 0xc1, 0x55, 0xb0, 0x1b,
+    0x83, 0xdb, 0x9b, 0x6d, 0xe9, 0x87, 0x1f, 0x99, 0x3d, 0x18, 0x97, 0x8a, 0xd3, 0xe8, 0x49, 0xf9,
+    0x12, 0xb4, 0x58, 0xa0, 0xd9, 0xfe, 0x68, 0xdc, 0xef, 0xc3, 0x40, 0x77, 0x0d, 0xca, 0x51, 0x2e,
+    0x2e, 0xe3, 0x6c, 0x5c, 0xa8, 0x68, 0x0c, 0xd2, 0xd0, 0x2a, 0x40, 0xcb, 0x08, 0xd2, 0xda, 0x2a,
+    0xa7, 0x9c, 0xdf, 0xfd, 0x92, 0x17, 0xc3, 0xbe, 0x42, 0xee, 0xeb, 0xfe, 0xec, 0xc5, 0xa0, 0x8d,
+    0x74, 0xf6, 0x46, 0xae, 0xab, 0xe5, 0x70, 0x37, 0xc8, 0xc1, 0x64, 0xb5, 0xd6, 0x39, 0xcf, 0xae,
+    0x78, 0xa5, 0xf1, 0x63, 0x8f, 0xa1, 0xe0, 0xb3, 0xa0, 0x0a, 0x5e, 0x71, 0xcb, 0x15, 0x5c, 0x5d,
+    0x72, 0xb6, 0xde, 0x47, 0xe3, 0x62, 0x10, 0xd8, 0xde, 0x21, 0x4d, 0x53, 0xd5, 0xc4, 0x81, 0xc3,
+    0x75, 0x3c, 0x4c, 0x1b, 0x76, 0x7c, 0x6e, 0x91, 0x24, 0xa9, 0x38, 0x14, 0x07, 0x4d, 0xea, 0x9e,
+    0xdf, 0x9a, 0x15, 0x9d, 0x50, 0xec, 0x3d, 0xa0, 0x55, 0xe9, 0x27, 0x59, 0x96, 0x07, 0xbc, 0xe9,
+    0xb6, 0xe1, 0xc6, 0xbe, 0xb7, 0xc7, 0x52, 0xf9, 0x7d, 0x2c, 0x35, 0xbc, 0x83, 0x83, 0x03, 0x94,
+    0x73, 0x45, 0xe1, 0x19, 0x53, 0x84, 0x82, 0x26, 0xed, 0xad, 0x3f, 0x47, 0x6c, 0x1a, 0x0e, 0x17,
+    0xb3, 0x05, 0xf2, 0x87, 0xca, 0x74, 0x7b, 0x0b, 0xdd, 0x0e, 0xd5, 0x9e, 0x56, 0x3a, 0x3f, 0x4a,
+    0x5d, 0x44, 0x9a, 0xb2, 0x24, 0x07, 0xc8, 0x93, 0x24, 0x0b, 0xa9, 0x57, 0x43, 0x99, 0x7e, 0xaa,
+    0x13, 0xb3, 0xec, 0x05, 0xa5, 0xda, 0xb5, 0xe2, 0xe2, 0x09, 0xde, 0xa6, 0x45, 0x20, 0x31, 0x34,
+    0x40, 0x8b, 0x28, 0x64, 0x3b, 0x6c, 0xfb, 0x39, 0xe6, 0xaf, 0xb3, 0xc7, 0xea, 0xf0, 0xba, 0x5d,
+    0xae, 0xeb, 0x26, 0x2b, 0xf5, 0x64, 0xdd, 0xe6, 0xab, 0xc3, 0x38, 0x87, 0x61, 0xc3, 0x53, 0x96,
+    0x95, 0x0a, 0x3e, 0xc9, 0xed, 0x78, 0xed, 0x95, 0x32, 0x78, 0xa0, 0x3c, 0x54, 0x3b, 0x4a, 0x56,
+    0xeb, 0x72, 0x1b, 0x4c, 0xd0, 0x09, 0x0f, 0x4e, 0x19, 0x64, 0x62, 0xbb, 0xd5, 0x76, 0xec, 0xff,
+    0xcd, 0xdf, 0x63, 0xdc, 0x5c, 0x67, 0x3c, 0xa8, 0xe8, 0x15, 0x25, 0x65, 0xed, 0x70, 0xb7, 0xfd,
+    0xdb, 0xd7, 0xf4, 0x77, 0x26, 0xfb, 0x43, 0xd9, 0x84, 0x49, 0xe5, 0x9e, 0xa1, 0x14, 0xed, 0x0e,
+    0x25, 0x3b, 0x2e, 0x36, 0x23, 0xa4, 0xf9, 0x40, 0xe9, 0x8d, 0xc6, 0xbb, 0xa5, 0x53, 0xd6, 0x6f,
+    0xd2, 0x53, 0x82, 0x56, 0xe3, 0xc8, 0xef, 0xef, 0x5a, 0x31, 0x00, 0x0d, 0xbd, 0xb4, 0xd4, 0xa6,
+    0xd8, 0xa2, 0x2c, 0x77, 0x12, 0x36, 0x9a, 0xb4, 0xba, 0x56, 0xeb, 0xa1, 0xc9, 0x51, 0xa4, 0x0a,
+    0x2d, 0x4a, 0x6e, 0xa3, 0x6b, 0x21, 0x27, 0xbe, 0x07, 0x3e, 0xbf, 0x47, 0xf0, 0x25, 0xcb, 0x2b,
+    0x81, 0x64, 0x13, 0x30, 0xae, 0xd8, 0x8a, 0x04, 0x8c, 0x97, 0xef, 0xe3, 0x17, 0x74, 0xef, 0x3e,
+    0x7e, 0xf2, 0xc4, 0x32, 0xd0, 0xe8, 0x4d, 0xc4, 0x23, 0xce, 0xb1, 0x5c, 0x36, 0x53, 0xa3, 0xfa,
+    0xb0, 0x03, 0xde, 0x80, 0xdf, 0xcf, 0x18, 0xa4, 0xc3, 0x77, 0x3b, 0x9e, 0x7c, 0x14, 0x4f, 0x6d,
+    0x22, 0xef, 0xdc, 0xb1, 0x69, 0xb6, 0xb8, 0x24, 0xfd, 0xfe, 0x45, 0xe0, 0xdb, 0x4f, 0x50, 0xfc,
+    0x06, 0x32, 0xa6, 0xbe, 0xc7, 0x42, 0xbe, 0xea, 0x31, 0x4f, 0xa5, 0x0d, 0xa7, 0x0b, 0x37, 0xe4,
+    0xad, 0x46, 0x70, 0xa2, 0xd7, 0xc6, 0x2a, 0xde, 0x84, 0x04, 0x1b, 0x7c, 0xc1, 0x98, 0xf2, 0x9d,
+    0xca, 0x43, 0xee, 0x8a, 0xc3, 0x57, 0x5e, 0xae, 0xf8, 0x6c, 0x9f, 0x4a, 0x69, 0xa6, 0x24, 0xc9,
+    0x8f, 0xdb, 0x47, 0xdc, 0x57, 0x39, 0x19, 0xdf, 0xd3, 0x57, 0x67, 0x63, 0x90, 0x6c, 0x5a, 0xa3,
+    0xc2, 0xca, 0x59, 0x45, 0x13, 0x5c, 0xf7, 0xc9, 0xc9, 0x46, 0xa1, 0x2e, 0xbb, 0xfd, 0xb2, 0xea,
+    0xd3, 0xbc, 0x31, 0x3e, 0xce, 0x86, 0xf6, 0x29, 0xbb, 0x47, 0xff, 0x34, 0x00, 0x71, 0x44, 0x92,
+    0x4b, 0x81, 0x41, 0xab, 0xef, 0xa2, 0xa1, 0x59, 0xd7, 0xcb, 0x2b, 0xb9, 0xbe, 0x97, 0x51, 0x6a,
+    0x61, 0x07, 0x0e, 0x3d, 0xbb, 0x0b, 0x9a, 0x1c, 0x70, 0xe4, 0xb4, 0x54, 0xfa, 0x73, 0x03, 0x6f,
+    0x0f, 0xed, 0x86, 0xd9, 0x68, 0x2a, 0xfb, 0xf5, 0x65, 0x18, 0xbd, 0x9f, 0x87, 0xa3, 0x30, 0x72,
+    0x39, 0xc8, 0xbc, 0xc7, 0x4c, 0x11, 0x0b, 0x8f, 0x21, 0x9b, 0x9a, 0x2b, 0x72, 0x62, 0xf9, 0x82,
+    0xe7, 0xf5, 0xb7, 0x9b, 0x61, 0xa8, 0x33, 0x77, 0xcc, 0xe9, 0x7c, 0x83, 0x7b, 0xb0, 0xdf, 0xab,
+    0xe0, 0xa9, 0xbb, 0x03, 0xeb, 0x0b, 0x2c, 0xc9, 0xfc, 0x8b, 0x70, 0x28, 0xf8, 0x99, 0x1e, 0x8f,
+    0x47, 0x61, 0x73, 0x82, 0x30, 0x6f, 0x8e, 0xbc, 0x2c, 0x45, 0xf7, 0x0e, 0x09, 0xf4, 0x7c, 0x5b,
+    0xbf, 0x4f, 0x8d, 0xd6, 0xcd, 0xd8, 0x7e, 0xd7, 0x6e, 0x21, 0x5e, 0xf1, 0x9d, 0x14, 0x61, 0x46,
+    0x14, 0x65, 0xa5, 0x4a, 0x24, 0xe6, 0xb7, 0x5e, 0xc7, 0x34, 0x96, 0x4c, 0x08, 0x86, 0x21, 0x6f,
+    0xd8, 0x8b, 0xa9, 0x50, 0xdd, 0x2a, 0x4c, 0xc6, 0xf7, 0xeb, 0x87, 0xd9, 0x70, 0x18, 0xa6, 0x11,
+    0x1d, 0x90, 0xd9, 0x08, 0xcd, 0x82, 0xa6, 0xc7, 0xaf, 0x6e, 0xac, 0x93, 0x52, 0x86, 0x6a, 0xe9,
+    0xad, 0xa2, 0x79, 0xbc, 0xa8, 0x5e, 0x36, 0xd2, 0x15, 0x16, 0xd9, 0xa9, 0x00, 0xea, 0x73, 0xbc,
+    0x4c, 0x72, 0xec, 0xdc, 0x93, 0xf9, 0x38, 0xda, 0xf1, 0x90, 0x00, 0x1e, 0x78, 0xc7, 0x25, 0x40,
+    0x3a, 0x4f, 0x28, 0x64, 0xaf, 0x1e, 0xdd, 0x4b, 0x5c, 0x76, 0x82, 0xe7, 0x2f, 0xff, 0xc5, 0x3b,
+    0x81, 0x05, 0x47, 0xff, 0x90, 0x6c, 0x9d, 0x9d, 0x3b, 0xb9, 0x83, 0xf2, 0xae, 0x02, 0x06, 0x33,
+    0x4d, 0x81, 0xa6, 0xfd, 0x04, 0x93, 0xe4, 0x02, 0x35, 0x6f, 0xa6, 0x1f, 0x6f, 0x08, 0x00, 0x84,
+    0x76, 0x99, 0x32, 0xb1, 0xee, 0x4a, 0x52, 0x9a, 0x9e, 0x4c, 0xf8, 0x55, 0x74, 0x10, 0x60, 0x97,
+    0xac, 0xee, 0x1a, 0x5a, 0x80, 0x14, 0x9e, 0x09, 0x26, 0x09, 0xb0, 0xb9, 0x80, 0x19, 0xcf, 0x92,
+    0x4d, 0xb7, 0xaf, 0xf9, 0x43, 0x66, 0x5a, 0xe9, 0x55, 0x59, 0x46, 0x9a, 0xc9, 0x3b, 0xe3, 0x69,
+    0x2c, 0xbd, 0x06, 0x3c, 0x68, 0x58, 0x53, 0xa1, 0xfb, 0x3a, 0x5a, 0x98, 0xce, 0x8f, 0xb4, 0xcc,
+    0x01, 0x6c, 0x2a, 0x29, 0xa8, 0xb4, 0x6c, 0xde, 0xc7, 0x4c, 0x5b, 0xa6, 0x42, 0x73, 0x41, 0xdd,
+    0x91, 0x00, 0x6e, 0xb7, 0x2a, 0x57, 0xcf, 0x31, 0xe0, 0x8f, 0x6b, 0x3a, 0x41, 0x37, 0xbd, 0xca,
+    0x64, 0xb8, 0x2a, 0x50, 0xdb, 0xb8, 0x3f, 0xaf, 0x70, 0xab, 0xe6, 0xe7, 0x15, 0xdc, 0xc0, 0xcf,
+    0x47, 0x0b, 0xde, 0xc2, 0xdf, 0x68, 0xa8, 0x0a, 0x9c, 0x4f, 0x39, 0x0c, 0x40, 0xec, 0x0e, 0xd1,
+    0xbb, 0xe3, 0x4d, 0x39, 0xd0, 0x7a, 0x13, 0xe9, 0xb1, 0x7f, 0x8d, 0xa6, 0x46, 0x86, 0x3a, 0xc4,
+    0x3c, 0x90, 0x20, 0xba, 0x3f, 0xe4, 0x18, 0xb5, 0x0c, 0x26, 0x70, 0xd3, 0x34, 0xbf, 0x4a, 0xd3,
+    0xd0, 0x0c, 0x75, 0xfb, 0xdc, 0x77, 0xfa, 0x4c, 0x17, 0xf4, 0xa9, 0x17, 0xc5, 0xea, 0xef, 0xc1,
+    0xe8, 0x97, 0x0f, 0x38, 0x6b, 0x9d, 0x93, 0xae, 0xe3, 0x65, 0xf8, 0x42, 0x98, 0x32, 0xd0, 0x7b,
+    0xe3, 0x3c, 0x87, 0xbf, 0xa7, 0x61, 0x7e, 0x81, 0x89, 0x46, 0xea, 0x12, 0x45, 0xbe, 0x10, 0x7d,
+    0x9c, 0x40, 0x07, 0x7d, 0x8c, 0x60, 0x1b, 0x1d, 0x21, 0x26, 0xd6, 0x46, 0x03, 0xe1, 0x8f, 0xe9,
+    0x20, 0x3b, 0xdb, 0xc4, 0xce, 0x36, 0x9a, 0xe7, 0xd8, 0x0d, 0xba, 0xbc, 0xe4, 0x67, 0x19, 0xca,
+    0xff, 0xcb, 0xe3, 0xca, 0xb7, 0x1a, 0x1d, 0xeb, 0xa1, 0x33, 0xa6, 0x7a, 0x21, 0x5d, 0xce, 0x75,
+    0x8e, 0xa3, 0xc0, 0x88, 0x69, 0x71, 0x08, 0x58, 0xd2, 0x1c, 0xc5, 0x64, 0xbf, 0x99, 0x10, 0x30,
+    0xfb, 0x49, 0xf0, 0x5a, 0x8a, 0xf1, 0xe6, 0x40, 0xb4, 0x38, 0x51, 0xf4, 0x87, 0x70, 0x33, 0x21,
+    0x20, 0x8c, 0xc8, 0xe0, 0x37, 0xf5, 0xe4, 0x98, 0x1a, 0x7e, 0x71, 0x17, 0xf4, 0x88, 0x05, 0x04,
+    0x56, 0x66, 0x98, 0xb5, 0x24, 0xf1, 0xaf, 0x7b, 0x0a, 0xcd, 0x8f, 0xec, 0x1e, 0x95, 0xe0, 0x30,
+    0x2d, 0xe3, 0x60, 0x3a, 0xca, 0xca, 0x60, 0xc2, 0x51, 0x2b, 0xd7, 0xc7, 0x8f, 0x6b, 0x31, 0xf1,
+    0x36, 0x54, 0x4c, 0x64, 0x77, 0x65, 0x6a, 0x17, 0xd0, 0x99, 0x01, 0x1c, 0x6d, 0x21, 0xd5, 0x93,
+    0x5d, 0x59, 0x40, 0x7a, 0xa6, 0xbb, 0x94, 0x35, 0xed, 0xac, 0xad, 0xc4, 0x3f, 0x33, 0x71, 0xf3,
+    0x44, 0x84, 0x94, 0xe6, 0xaf, 0xdc, 0x60, 0x14, 0xe6, 0xee, 0x20, 0xb7, 0x41, 0x25, 0x05, 0x8c,
+    0x0d, 0xaf, 0x54, 0x28, 0x36, 0xc8, 0x58, 0x4e, 0xd6, 0xa9, 0xfc, 0x3c, 0x91, 0x5c, 0x1f, 0xb9,
+    0x4d, 0x68, 0x6d, 0x6e, 0x00, 0x3e, 0x1e, 0xd1, 0x8f, 0x7a, 0x11, 0x05, 0x37, 0x00, 0xef, 0x85,
+    0x69, 0x4f, 0x24, 0x4e, 0x97, 0xb9, 0xf9, 0x61, 0x68, 0x9e, 0xae, 0x91, 0x96, 0x8a, 0x91, 0x75,
+    0x26, 0x2b, 0xee, 0xbf, 0xf1, 0x3e, 0xf7, 0x8a, 0x91, 0x44, 0xda, 0xa0, 0xe1, 0x0b, 0xdd, 0x39,
+    0x73, 0x07, 0x69, 0x99, 0xff, 0x15, 0xa6, 0xc5, 0xd3, 0x5c, 0x08, 0x5b, 0x33, 0xc7, 0x85, 0xb0,
+    0x35, 0x13, 0xa4, 0x31, 0xe4, 0x2b, 0x91, 0xca, 0xb4, 0xe4, 0xaa, 0xab, 0x8f, 0x69, 0x43, 0xad,
+    0x3d, 0xad, 0x16, 0x85, 0x7f, 0x4a, 0xbd, 0x8e, 0xbc, 0xba, 0xcb, 0xfb, 0x37, 0xc9, 0x6f, 0x4f,
+    0x62, 0x5a, 0x8a, 0x79, 0x86, 0x9d, 0x94, 0xa0, 0x95, 0x87, 0x78, 0x03, 0x76, 0x39, 0xe6, 0x85,
+    0xf4, 0x2e, 0xc2, 0x8a, 0xa8, 0x54, 0x42, 0x39, 0xf3, 0x02, 0xa8, 0x37, 0x2c, 0xbd, 0xa0, 0x7a,
+    0xaf, 0x15, 0x89, 0x50, 0xca, 0x26, 0xc3, 0x6f, 0xec, 0x8f, 0x7f, 0x41, 0x67, 0x4f, 0xf1, 0xf7,
+    0xb6, 0x04, 0x39, 0x69, 0x83, 0x7b, 0x6d, 0x80, 0x46, 0xdd, 0x79, 0xaf, 0x4d, 0xae, 0xfd, 0xef,
+    0x83, 0x41, 0x63, 0x81, 0xe1, 0xc6, 0x64, 0xa8, 0x75, 0x6f, 0xea, 0x42, 0xcd, 0x6c, 0x4f, 0xe5,
+    0x07, 0xde, 0x0c, 0xb4, 0x15, 0x74, 0x59, 0x63, 0xbb, 0x4e, 0xb4, 0xb1, 0xbd, 0x45, 0x83, 0x35,
+    0x3d, 0x4c, 0x9a, 0x9b, 0x5a, 0xb5, 0xd5, 0x0c, 0x56, 0xe7, 0x6d, 0x78, 0x1c, 0xd5, 0x38, 0x22,
+    0x4e, 0x11, 0xc4, 0x72, 0x44, 0xec, 0x18, 0xc1, 0xfd, 0xb0, 0x9f, 0x28, 0xaa, 0xda, 0x77, 0xee,
+    0x6f, 0xb0, 0x01, 0xa9, 0x4c, 0x8c, 0xcf, 0xdb, 0xc7, 0x49, 0x82, 0x5b, 0xf8, 0xa6, 0x24, 0xcd,
+    0x2a, 0x8f, 0xaa, 0x9c, 0xd9, 0x39, 0x8f, 0xad, 0x2b, 0x93, 0xfb, 0xd5, 0xaf, 0xbd, 0x43, 0x6c,
+    0xfe, 0x43, 0xce, 0x8c, 0x7e, 0x43, 0x0e, 0x26, 0x46, 0x74, 0xfc, 0x1e, 0xe7, 0xe5, 0x3c, 0x64,
+    0xc6, 0x01, 0x6b, 0x9c, 0x48, 0xdf, 0xd2, 0x1e, 0x02, 0xc0, 0x39, 0x1f, 0x12, 0x2c, 0xfa, 0x8e,
+    0x67, 0x3b, 0x8c, 0x7e, 0x3f, 0x93, 0xa5, 0x77, 0xe8, 0x30, 0x59, 0x22, 0xce, 0x6f, 0x9a, 0xf3,
+    0xd9, 0x44, 0x97, 0x3f, 0x76, 0xea, 0xd6, 0x6e, 0x39, 0xc1, 0x37, 0x8a, 0x1f, 0xb1, 0x63, 0xb0,
+    0x9f, 0xde, 0x35, 0x58, 0xb8, 0xc1, 0xad, 0xcf, 0x7e, 0x66, 0xbb, 0x80, 0xcb, 0xff, 0x01, 0x96,
+    0x75, 0x49, 0x6e, 0xba, 0x3f, 0x28, 0x6b, 0x8f, 0x4e, 0x91, 0xb1, 0xa2, 0x54, 0x6c, 0xa5, 0x9b,
+    0xc0, 0xef, 0x81, 0xb1, 0x8e, 0x5d, 0x66, 0xbd, 0xf4, 0xc5, 0xc1, 0xa3, 0x38, 0xe7, 0x4b, 0xaa,
+    0xf5, 0xab, 0x5b, 0x1f, 0xe8, 0x05, 0x21, 0x23, 0x3b, 0x66, 0x4f, 0x81, 0x6b, 0x43, 0xcb, 0x20,
+    0x8c, 0x35, 0x19, 0x02, 0xe3, 0x37, 0xed, 0x4e, 0xfa, 0x94, 0xd2, 0x91, 0xfa, 0xc9, 0xdd, 0x5c,
+    0x9f, 0x61, 0x88, 0x39, 0x00, 0xdc, 0x1e, 0x4e, 0x6a, 0xda, 0xe3, 0xb4, 0xd1, 0x9c, 0x1f, 0x4a,
+    0xae, 0xe6, 0x9a, 0x99, 0x28, 0x06, 0x5c, 0x70, 0x7c, 0xa4, 0x7c, 0xde, 0x95, 0x32, 0xef, 0xc7,
+    0x88, 0x97, 0x7b, 0x30, 0xaa, 0xe2, 0x63, 0x0f, 0xbb, 0x3b, 0xaf, 0x84, 0xe5, 0x2f, 0x22, 0xe2,
+    0xdd, 0xc4, 0xfe, 0x95, 0xd5, 0x5b, 0xa6, 0x64, 0xe5, 0xee, 0x76, 0xb3, 0x68, 0x5a, 0xe3, 0x0e,
+    0x8b, 0x00, 0x12, 0x64, 0xc4, 0x74, 0x31, 0xf6, 0x2b, 0x62, 0xef, 0xf4, 0x96, 0x7a, 0x2b, 0x7d,
+    0x0d, 0xa4, 0x16, 0x4f, 0x57, 0x50, 0x68, 0x44, 0x15, 0x2a, 0x5b, 0xc7, 0x4d, 0x55, 0xfa, 0xee,
+    0xd7, 0x3f, 0x05, 0xcd, 0x43, 0x5e, 0x88, 0xdf, 0xfe, 0xe6, 0x67, 0x7f, 0x47, 0xa7, 0x1d, 0xbe,
+    0xc0, 0x4d, 0x4e, 0xca, 0x2c, 0x87, 0x6b, 0x30, 0x5d, 0x28, 0x4a, 0x31, 0x64, 0x62, 0xb1, 0x57,
+    0x95, 0x60, 0xb3, 0xbb, 0xfe, 0xcd, 0x23, 0xa6, 0xa8, 0xe7, 0x6e, 0x72, 0x77, 0xb9, 0xe3, 0xd1,
+    0x94, 0x71, 0xb4, 0x84, 0xb2, 0x8d, 0x68, 0xd7, 0x1d, 0x77, 0xbf, 0x46, 0xd3, 0xf8, 0x9d, 0x98,
+    0x16, 0x9c, 0xf6, 0x55, 0x34, 0xcc, 0x63, 0x10, 0x2c, 0x77, 0x22, 0x93, 0x79, 0x62, 0x62, 0xe0,
+    0xdc, 0xf2, 0x46, 0x65, 0xe4, 0xc8, 0x58, 0x37, 0xd7, 0xda, 0xe9, 0x0f, 0x0a, 0xce, 0x7e, 0x4c,
+    0x59, 0x03, 0x2f, 0x03, 0xe3, 0x12, 0xda, 0x8d, 0x87, 0x5b, 0x28, 0xaa, 0xd9, 0x28, 0xd6, 0xaf,
+    0x63, 0x1a, 0xaf, 0x52, 0x78, 0x29, 0xb8, 0x12, 0x33, 0x95, 0x6c, 0x6e, 0x5e, 0xcc, 0x71, 0x53,
+    0x39, 0x93, 0xac, 0x2e, 0xe8, 0xdc, 0xc3, 0xfb, 0x19, 0xf9, 0x0a, 0x1d, 0x69, 0x63, 0x25, 0xb0,
+    0xe4, 0x87, 0x40, 0xd5, 0xd1, 0x65, 0xde, 0x7a, 0xea, 0xd4, 0xfa, 0x56, 0x49, 0xd7, 0xb2, 0x5a,
+    0x57, 0xb2, 0xf3, 0x4b, 0x29, 0x3e, 0x6e, 0x89, 0x95, 0xa5, 0xf0, 0xf3, 0xae, 0x67, 0x0d, 0x2e,
+    0xad, 0xa9, 0x3c, 0x4c, 0x0b, 0xcc, 0x1d, 0xc3, 0xc4, 0x32, 0x0a, 0xc7, 0x04, 0xed, 0xd6, 0x67,
+    0xf7, 0x1a, 0xbe, 0xf3, 0xe6, 0x55, 0x5d, 0x2a, 0x96, 0x75, 0x46, 0x89, 0x04, 0xd3, 0xf3, 0x5e,
+    0x5b, 0x33, 0x7f, 0xc9, 0xf4, 0x2f, 0xe3, 0x22, 0xee, 0xc6, 0x49, 0x5c, 0x4e, 0x59, 0x06, 0x6d,
+    0x4e, 0xe8, 0xe7, 0x3e, 0xaa, 0xfb, 0x20, 0x8e, 0x22, 0x91, 0xba, 0x4f, 0x57, 0xff, 0xd3, 0x7b,
+    0x89, 0x5e, 0x26, 0x6e, 0xa2, 0xab, 0x5d, 0x34, 0xee, 0xe1, 0x79, 0xc1, 0x2e, 0x45, 0xaf, 0x4f,
+    0x4f, 0x25, 0xd2, 0xde, 0xd4, 0xaf, 0x79, 0x9b, 0x6b, 0xfa, 0x13, 0x1d, 0x89, 0x20, 0x04, 0xc5,
+    0x98, 0xac, 0xe2, 0x14, 0x13, 0xe9, 0x12, 0x89, 0x47, 0xfb, 0x10, 0xeb, 0x0e, 0x9b, 0x5b, 0xb5,
+    0x87, 0x8d, 0xfd, 0xac, 0xd4, 0x79, 0x8b, 0x6c, 0x40, 0x5b, 0x2d, 0x42, 0xeb, 0xbe, 0xdf, 0x67,
+    0x91, 0x99, 0xe9, 0x8d, 0x0a, 0x18, 0xbe, 0xfd, 0xa9, 0xa7, 0x7f, 0xe1, 0xd5, 0xfb, 0x22, 0xbc,
+    0x0c, 0x4f, 0xe8, 0x97, 0x16, 0xe8, 0xe5, 0x7f, 0x1c, 0x26, 0x18, 0xf5, 0x07, 0x44, 0xff, 0x07,
+    0xc9, 0x47, 0xf4, 0x36, 0x49, 0x5a, 0x00, 0x00
+};
+const size_t DASHBOARD_APP_DEBUG_JS_GZ_LEN = 6760;
+
+#define DASHBOARD_INDEX_HTML_VERSION "d1a54c4c"
+const uint8_t DASHBOARD_INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x54, 0xcd, 0x6e, 0x13, 0x31,
+    0x10, 0x7e, 0x15, 0xe3, 0x03, 0x49, 0x24, 0x76, 0xb7, 0x1b, 0x2a, 0x4a, 0xe9, 0xee, 0xf6, 0x90,
+    0x16, 0x89, 0x53, 0x2b, 0x35, 0x1c, 0x10, 0x70, 0xf0, 0xda, 0x93, 0xac, 0xa9, 0x63, 0x47, 0xb6,
+    0x93, 0x52, 0x21, 0x5e, 0x00, 0x21, 0x10, 0xe2, 0x84, 0x38, 0xf4, 0xc4, 0x3b, 0xf0, 0x56, 0xe4,
+    0x11, 0xf0, 0x5f, 0x42, 0x42, 0x7a, 0xb1, 0x32, 0xdf, 0x8c, 0xbf, 0xf9, 0x3c, 0xdf, 0x6c, 0xaa,
+    0x07, 0x67, 0x17, 0xa3, 0xf1, 0xab, 0xcb, 0x73, 0xd4, 0xd9, 0x99, 0x68, 0x2a, 0x7f, 0x22, 0x41,
+    0xe4, 0xb4, 0xc6, 0x20, 0xb1, 0x8b, 0x81, 0xb0, 0xa6, 0x9a, 0x81, 0x25, 0x88, 0x76, 0x44, 0x1b,
+    0xb0, 0x35, 0x7e, 0x39, 0x7e, 0x9e, 0x3d, 0xc5, 0x09, 0x95, 0x64, 0x06, 0x35, 0x5e, 0x72, 0xb8,
+    0x99, 0x2b, 0x6d, 0x31, 0xa2, 0x4a, 0x5a, 0x90, 0xae, 0xea, 0x86, 0x33, 0xdb, 0xd5, 0x0c, 0x96,
+    0x9c, 0x42, 0x16, 0x82, 0x47, 0x88, 0x4b, 0x6e, 0x39, 0x11, 0x99, 0xa1, 0x44, 0x40, 0x5d, 0xe6,
+    0x07, 0x8e, 0xc5, 0x72, 0x2b, 0xa0, 0x39, 0xbf, 0xba, 0x7c, 0x3c, 0x44, 0x67, 0xc4, 0x74, 0xad,
+    0x22, 0x9a, 0x55, 0x45, 0x84, 0x2b, 0xc1, 0xe5, 0x35, 0xd2, 0x20, 0x6a, 0x6c, 0xec, 0xad, 0x00,
+    0xd3, 0x01, 0xb8, 0x26, 0x9d, 0x86, 0x49, 0x8d, 0x0b, 0x32, 0x9f, 0xe7, 0xd4, 0x98, 0xd3, 0x65,
+    0x4d, 0x87, 0x47, 0xc7, 0x93, 0xc3, 0x27, 0xad, 0xe3, 0x33, 0x54, 0xf3, 0xb9, 0x6d, 0x50, 0x7f,
+    0xb2, 0x90, 0xd4, 0x72, 0x25, 0xfb, 0x03, 0xf4, 0x01, 0x2d, 0x89, 0x46, 0x31, 0x83, 0x6a, 0xc4,
+    0x14, 0x5d, 0xcc, 0x9c, 0xc8, 0x9c, 0x6a, 0x20, 0x16, 0xce, 0x05, 0xf8, 0xa8, 0xdf, 0x8b, 0x05,
+    0xbd, 0xc1, 0x49, 0x2a, 0xcd, 0x8d, 0xa6, 0xae, 0xbc, 0x78, 0x7d, 0xfa, 0xf0, 0x2d, 0x83, 0x76,
+    0x31, 0x7d, 0xd3, 0x16, 0xb9, 0x05, 0x63, 0xfb, 0x42, 0x51, 0xe2, 0xb9, 0x73, 0x03, 0x44, 0xd3,
+    0x6e, 0x80, 0x4e, 0x51, 0x2f, 0xc8, 0x09, 0x65, 0xf9, 0x3b, 0xaf, 0xa9, 0x3d, 0x1a, 0x0e, 0xcb,
+    0x12, 0xda, 0x1e, 0x7a, 0x96, 0x92, 0x01, 0x3e, 0x2a, 0xa1, 0x3c, 0x9c, 0x1c, 0x97, 0xbd, 0x93,
+    0x7f, 0x3a, 0xfc, 0x94, 0x73, 0x57, 0x01, 0x92, 0x8d, 0x3a, 0x2e, 0x58, 0x3f, 0xf6, 0x77, 0x42,
+    0x3e, 0x0e, 0xfa, 0xee, 0xac, 0x8a, 0xf4, 0xaa, 0xaa, 0x88, 0x86, 0xb4, 0x8a, 0xdd, 0x36, 0x15,
+    0xe3, 0x4b, 0x44, 0x05, 0x31, 0xa6, 0xc6, 0x6c, 0x3d, 0xb9, 0xcc, 0x1b, 0x40, 0xb8, 0x04, 0x9d,
+    0xdc, 0x03, 0xbd, 0x5f, 0x13, 0x71, 0xbc, 0xc3, 0x10, 0xb1, 0x2c, 0xf9, 0xb7, 0x9b, 0x13, 0x6a,
+    0xaa, 0x32, 0x03, 0x61, 0x9c, 0xf7, 0x64, 0x38, 0xf5, 0xf0, 0xea, 0xee, 0xfb, 0xa7, 0xaa, 0x70,
+    0xb9, 0xfd, 0x02, 0x0b, 0xef, 0x3d, 0x63, 0x57, 0x22, 0xce, 0xb6, 0x74, 0x8c, 0xbd, 0xc7, 0xd8,
+    0x3f, 0xaa, 0x6c, 0xaa, 0xf9, 0x6e, 0xee, 0x6a, 0xd1, 0xda, 0x75, 0x7a, 0xde, 0x24, 0xde, 0x3d,
+    0xf6, 0x2d, 0xd1, 0x5a, 0x09, 0x93, 0xb4, 0x79, 0x22, 0x07, 0xc9, 0x28, 0xf8, 0xca, 0x12, 0xbb,
+    0x30, 0x78, 0x7d, 0xc5, 0x84, 0x30, 0xe3, 0x92, 0x71, 0xe7, 0xa1, 0xd2, 0x48, 0x49, 0xb7, 0x64,
+    0xb0, 0xfb, 0xac, 0x54, 0xc4, 0x94, 0x97, 0x1d, 0xbb, 0x9a, 0x39, 0x91, 0xcd, 0x45, 0xa8, 0x75,
+    0x76, 0xf8, 0x60, 0x4b, 0x4e, 0xe8, 0x28, 0xb8, 0x1b, 0xdc, 0x48, 0x2d, 0xdc, 0x00, 0xf5, 0xa6,
+    0x5d, 0x44, 0x9d, 0xc2, 0x08, 0x27, 0x9e, 0xd5, 0xdd, 0xb7, 0x5f, 0x28, 0xfc, 0xfc, 0xff, 0x2a,
+    0x6e, 0x0e, 0x36, 0xf4, 0xdb, 0x5d, 0xda, 0x85, 0xb5, 0x4a, 0xae, 0x59, 0x6d, 0xe7, 0x56, 0x36,
+    0xb3, 0x6a, 0x3a, 0x75, 0x13, 0x72, 0x2f, 0x70, 0x04, 0xf4, 0xda, 0xc1, 0x01, 0x18, 0xfb, 0x64,
+    0x7f, 0x80, 0x51, 0x18, 0x60, 0x8d, 0xc7, 0x01, 0x45, 0x01, 0x4e, 0x02, 0x42, 0xd7, 0x40, 0xf2,
+    0x22, 0x79, 0xf7, 0xf9, 0xc7, 0xa6, 0x5f, 0x6c, 0xb5, 0x3b, 0xf3, 0x22, 0x4e, 0xda, 0x7d, 0xf4,
+    0x6e, 0xb7, 0xf6, 0x17, 0xca, 0xa3, 0xbb, 0x13, 0xa4, 0x0e, 0x36, 0xd9, 0x54, 0x73, 0x86, 0xe3,
+    0x13, 0x7d, 0x3c, 0xda, 0xda, 0xcd, 0x3d, 0x2f, 0xd7, 0x26, 0x6e, 0x2d, 0x5a, 0x37, 0xdc, 0x18,
+    0x12, 0xb1, 0x2c, 0xed, 0xc4, 0xea, 0xee, 0xcb, 0xcf, 0x3f, 0xbf, 0xbf, 0xa2, 0x51, 0xba, 0xe3,
+    0xf4, 0x0d, 0xef, 0x27, 0xdb, 0x52, 0x90, 0xa0, 0x7d, 0x11, 0xe9, 0xf4, 0x8f, 0xd8, 0x04, 0xf1,
+    0x0b, 0x2b, 0xc2, 0xbf, 0xe2, 0x5f, 0x4a, 0x9a, 0x26, 0xae, 0x25, 0x05, 0x00, 0x00
+};
+const size_t DASHBOARD_INDEX_HTML_GZ_LEN = 654;
+
+#endif
@@ -0,0 +1,112 @@
+#include "DashboardCapture.h"
+
+// The loop drains continuously, so the ring only has to bridge the gaps
+// between loop() calls, not hold the whole burst
+static const uint32_t MAX_RING_SIZE = 1024;
+
+DashboardCapture::DashboardCapture() {
+    timer = nullptr;
+    ring = nullptr;
+    ringMask = 0;
+    head = 0;
+    tail = 0;
+    produced = 0;
+    dropped = 0;
+    target = 0;
+    sampleRate = 0;
+}
+
+DashboardCapture::~DashboardCapture() {
+    stop();
+    if (timer) esp_timer_delete(timer);
+    delete[] ring;
+}
+
+bool DashboardCapture::start(std::function<float()> sampler, uint32_t sampleRate, uint32_t samples) {
+    if (isRunning() || !sampler || sampleRate == 0 || samples == 0) return false;
+
+    uint32_t size = 1;
+    while (size < samples && size < MAX_RING_SIZE) size <<= 1;
+    if (!ring || size - 1 != ringMask) {
+        delete[] ring;
+        ring = new float[size];
+        ringMask = size - 1;
+    }
+
+    if (!timer) {
+        esp_timer_create_args_t args = {};
+        args.callback = &DashboardCapture::onTimer;
+        args.arg = this;
+        args.dispatch_method = ESP_TIMER_TASK;
+        args.name = "dash_capture";
+        if (esp_timer_create(&args, &timer) != ESP_OK) {
+            timer = nullptr;
+            return false;
+        }
+    }
+
+    this->sampler = sampler;
+    this->sampleRate = sampleRate;
+    target = samples;
+    head = 0;
+    tail = 0;
+    produced = 0;
+    dropped = 0;
+
+    return esp_timer_start_periodic(timer, 1000000ULL / sampleRate) == ESP_OK;
+}
+
+void DashboardCapture::stop() {
+    if (timer) esp_timer_stop(timer);
+    target = produced.load();
+}
+
+void DashboardCapture::onTimer(void* arg) {
+    static_cast<DashboardCapture*>(arg)->produce();
+}
+
+void DashboardCapture::produce() {
+    if (produced >= target) {
+        esp_timer_stop(timer);
+        return;
+    }
+
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) > ringMask) {
+        dropped++;
+    }
+    else {
+        ring[h & ringMask] = sampler();
+        head.store(h + 1, std::memory_order_release);
+    }
+    produced++;
+}
+
+size_t DashboardCapture::drain(std::vector<float>& out) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+
+    size_t count = h - t;
+    for (; t != h; t++) {
+        out.push_back(ring[t & ringMask]);
+    }
+    tail.store(t, std::memory_order_release);
+
+    return count;
+}
+
+bool DashboardCapture::isRunning() const {
+    return target > 0 && produced < target;
+}
+
+bool DashboardCapture::isFinished() const {
+    return target > 0 && produced >= target && head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed);
+}
+
+uint32_t DashboardCapture::getSampleRate() const {
+    return sampleRate;
+}
+
+uint32_t DashboardCapture::getDropped() const {
+    return dropped;
+}
@@ -0,0 +1,50 @@
+#ifndef DASHBOARDCAPTURE_H
+#define DASHBOARDCAPTURE_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <atomic>
+#include <functional>
+
+// Fixed-rate burst sampler for chart cards.
+// An esp_timer calls the sampler and pushes into a single-producer /
+// single-consumer ring; loop() drains it without locks. Samples that find
+// the ring full are counted as dropped rather than blocking the timer.
+class DashboardCapture {
+private:
+	std::function<float()> sampler;
+	esp_timer_handle_t timer;
+	float* ring;
+	uint32_t ringMask;
+	std::atomic<uint32_t> head;
+	std::atomic<uint32_t> tail;
+	std::atomic<uint32_t> produced;
+	std::atomic<uint32_t> dropped;
+	// Written by stop() in loop() while the timer task reads it
+	std::atomic<uint32_t> target;
+	uint32_t sampleRate;
+
+	static void onTimer(void* arg);
+	void produce();
+
+public:
+	// Largest burst startCapture() accepts; the block is held in RAM until
+	// it has been sent
+	static const uint32_t MAX_SAMPLES = 8192;
+
+	DashboardCapture();
+	~DashboardCapture();
+
+	// The sampler runs in the esp_timer task, not in loop()
+	bool start(std::function<float()> sampler, uint32_t sampleRate, uint32_t samples);
+	void stop();
+
+	// Consumer side: moves everything captured so far into out
+	size_t drain(std::vector<float>& out);
+	bool isRunning() const;
+	bool isFinished() const;
+	uint32_t getSampleRate() const;
+	uint32_t getDropped() const;
+};
+
+#endif
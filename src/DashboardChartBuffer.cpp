@@ -0,0 +1,136 @@
+#include "DashboardChartBuffer.h"
+#include "DashboardCodec.h"
+#include <cmath>
+
+// DELTA: gap marker in place of a quantized value, and the quantized range
+// (2^51 - 1, so step deltas and their zigzag stay exact as JS numbers)
+static const int64_t GAP = INT64_MIN;
+static const double MAX_QUANTIZED = 2251799813685247.0;
+static const float NAN_VALUE = NAN;
+
+DashboardChartBuffer::DashboardChartBuffer() {
+    mode = CHART_COMPRESSION_NONE;
+    columns = 0;
+    precision = 2;
+    scale = 100;
+    rows = 0;
+    baseTimestamp = 0;
+    lastTimestamp = 0;
+}
+
+void DashboardChartBuffer::configure(ChartCompression mode, uint8_t columns, int precision) {
+    this->mode = mode;
+    this->columns = columns;
+    this->precision = precision;
+    scale = powf(10, precision);
+    clear();
+}
+
+void DashboardChartBuffer::clear() {
+    bytes.clear();
+    rows = 0;
+    baseTimestamp = 0;
+    lastTimestamp = 0;
+    baseColumns.assign(columns, 0);
+    lastColumns.assign(columns, 0);
+}
+
+int64_t DashboardChartBuffer::encodeColumn(float value) const {
+    if (mode == CHART_COMPRESSION_XOR) {
+        uint32_t bits;
+        memcpy(&bits, std::isfinite(value) ? &value : &NAN_VALUE, sizeof(bits));
+        return bits;
+    }
+    if (!std::isfinite(value)) return GAP;
+
+    double quantized = (double)value * scale;
+    if (quantized > MAX_QUANTIZED) quantized = MAX_QUANTIZED;
+    if (quantized < -MAX_QUANTIZED) quantized = -MAX_QUANTIZED;
+    return llround(quantized);
+}
+
+void DashboardChartBuffer::appendColumn(int64_t value, int64_t previous) {
+    if (mode == CHART_COMPRESSION_XOR) {
+        uint32_t x = (uint32_t)value ^ (uint32_t)previous;
+        if (x == 0) {
+            DashboardCodec::appendVarint(bytes, 0);
+            return;
+        }
+        uint32_t trailing = __builtin_ctz(x);
+        DashboardCodec::appendVarint(bytes, ((uint64_t)(x >> trailing) << 5) | trailing);
+        return;
+    }
+    if (value == GAP) {
+        DashboardCodec::appendVarint(bytes, 0);
+        return;
+    }
+    int64_t delta = value - previous;
+    DashboardCodec::appendVarint(bytes, (((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63)) + 1);
+}
+
+int64_t DashboardChartBuffer::readColumn(const uint8_t*& in, int64_t previous) const {
+    if (mode == CHART_COMPRESSION_XOR) {
+        uint64_t raw = DashboardCodec::readVarint(in);
+        uint32_t x = (uint32_t)((raw >> 5) << (raw & 0x1F));
+        return (uint32_t)previous ^ x;
+    }
+
+    // A gap leaves the running value where it was
+    uint64_t raw = DashboardCodec::readVarint(in);
+    if (raw == 0) return previous;
+    raw--;
+    return previous + ((int64_t)(raw >> 1) ^ -(int64_t)(raw & 1));
+}
+
+void DashboardChartBuffer::append(uint64_t timestamp, const float* values) {
+    // Deltas are unsigned; a clock stepping back (SNTP correction) is held
+    if (timestamp < lastTimestamp) timestamp = lastTimestamp;
+
+    DashboardCodec::appendVarint(bytes, timestamp - lastTimestamp);
+    lastTimestamp = timestamp;
+
+    for (uint8_t i = 0; i < columns; i++) {
+        int64_t value = encodeColumn(values[i]);
+        appendColumn(value, lastColumns[i]);
+        if (value != GAP) lastColumns[i] = value;
+    }
+    rows++;
+}
+
+void DashboardChartBuffer::dropOldest() {
+    if (rows == 0) return;
+
+    // Decode the oldest row into the base and cut its bytes off the front
+    const uint8_t* in = bytes.data();
+    baseTimestamp += DashboardCodec::readVarint(in);
+    for (uint8_t i = 0; i < columns; i++) {
+        baseColumns[i] = readColumn(in, baseColumns[i]);
+    }
+
+    bytes.erase(bytes.begin(), bytes.begin() + (in - bytes.data()));
+    rows--;
+}
+
+ChartCompression DashboardChartBuffer::getMode() const {
+    return mode;
+}
+
+int DashboardChartBuffer::getPrecision() const {
+    return precision;
+}
+
+size_t DashboardChartBuffer::size() const {
+    return rows;
+}
+
+const std::vector<uint8_t>& DashboardChartBuffer::data() const {
+    return bytes;
+}
+
+uint64_t DashboardChartBuffer::getBaseTimestamp() const {
+    return baseTimestamp;
+}
+
+const std::vector<int64_t>& DashboardChartBuffer::getBaseColumns() const {
+    return baseColumns;
+}
@@ -0,0 +1,61 @@
+#ifndef DASHBOARDCHARTBUFFER_H
+#define DASHBOARDCHARTBUFFER_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Chart history compression modes
+enum ChartCompression {
+	CHART_COMPRESSION_NONE,
+	CHART_COMPRESSION_DELTA,
+	CHART_COMPRESSION_XOR
+};
+
+// Compressed chart history: rows of (timestamp, column values) stored as a
+// byte stream in which every row is encoded against the previous one.
+//   timestamp: varint of the delta in ms
+//   DELTA:     value quantized to the card's precision (clamped to +/-2^51 so
+//              the browser decodes it exactly), zigzag varint of the step
+//              delta + 1; 0 marks a gap (non-finite value) and the next delta
+//              is taken from the last real value
+//   XOR:       float bits XORed with the previous value (Gorilla-style, byte
+//              aligned): varint of (xor >> trailingZeros) << 5 | trailingZeros;
+//              non-finite values are stored as NaN and shown as gaps
+// The same bytes are sent to the browser, which decodes them starting from
+// the base row (the row just before the oldest stored one).
+class DashboardChartBuffer {
+private:
+	ChartCompression mode;
+	uint8_t columns;
+	int precision;
+	float scale;
+	std::vector<uint8_t> bytes;
+	size_t rows;
+
+	uint64_t baseTimestamp;
+	std::vector<int64_t> baseColumns;
+	uint64_t lastTimestamp;
+	std::vector<int64_t> lastColumns;
+
+	int64_t encodeColumn(float value) const;
+	void appendColumn(int64_t value, int64_t previous);
+	int64_t readColumn(const uint8_t*& in, int64_t previous) const;
+
+public:
+	DashboardChartBuffer();
+
+	void configure(ChartCompression mode, uint8_t columns, int precision);
+	void clear();
+
+	void append(uint64_t timestamp, const float* values);
+	void dropOldest();
+
+	ChartCompression getMode() const;
+	int getPrecision() const;
+	size_t size() const;
+	const std::vector<uint8_t>& data() const;
+	uint64_t getBaseTimestamp() const;
+	const std::vector<int64_t>& getBaseColumns() const;
+};
+
+#endif
@@ -0,0 +1,47 @@
+#include "DashboardClock.h"
+#include <esp_timer.h>
+#include <sys/time.h>
+
+// Anything before 2020-01-01 means the RTC has not been set by SNTP yet
+static const time_t MIN_VALID_EPOCH = 1577836800;
+
+DashboardClock::DashboardClock() {
+    sntpStarted = false;
+}
+
+void DashboardClock::beginSntp(const char* server1, const char* server2) {
+    // Timestamps are UTC; the browser applies its own time zone
+    configTime(0, 0, server1, server2);
+    sntpStarted = true;
+}
+
+void DashboardClock::setSource(std::function<uint64_t()> source) {
+    this->source = source;
+}
+
+bool DashboardClock::isSynced() const {
+    if (source) return true;
+    if (!sntpStarted) return false;
+
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return tv.tv_sec >= MIN_VALID_EPOCH;
+}
+
+uint64_t DashboardClock::now() const {
+    if (source) return source();
+
+    if (sntpStarted) {
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+        if (tv.tv_sec >= MIN_VALID_EPOCH) {
+            return (uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+        }
+    }
+
+    return uptime();
+}
+
+uint64_t DashboardClock::uptime() const {
+    return esp_timer_get_time() / 1000;
+}
@@ -0,0 +1,28 @@
+#ifndef DASHBOARDCLOCK_H
+#define DASHBOARDCLOCK_H
+
+#include <Arduino.h>
+#include <functional>
+
+// 64-bit millisecond clock for frame and chart timestamps.
+// Reports Unix epoch time once SNTP has synchronized (or a custom source is
+// set) and milliseconds since boot before that; never wraps.
+class DashboardClock {
+private:
+	std::function<uint64_t()> source;
+	bool sntpStarted;
+
+public:
+	DashboardClock();
+
+	void beginSntp(const char* server1, const char* server2 = nullptr);
+
+	// Replaces SNTP with another epoch-ms source (GPS, RTC, a test stand-in)
+	void setSource(std::function<uint64_t()> source);
+
+	bool isSynced() const;
+	uint64_t now() const;
+	uint64_t uptime() const;
+};
+
+#endif
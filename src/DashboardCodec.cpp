@@ -0,0 +1,66 @@
+#include "DashboardCodec.h"
+#include <cmath>
+
+void DashboardCodec::appendVarint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((uint8_t)value);
+}
+
+void DashboardCodec::appendZigZag(std::vector<uint8_t>& out, int64_t value) {
+    appendVarint(out, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+uint64_t DashboardCodec::readVarint(const uint8_t*& in) {
+    uint64_t value = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+        byte = *in++;
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+int64_t DashboardCodec::readZigZag(const uint8_t*& in) {
+    uint64_t raw = readVarint(in);
+    return (int64_t)(raw >> 1) ^ -(int64_t)(raw & 1);
+}
+
+void DashboardCodec::appendQuantizedDeltas(std::vector<uint8_t>& out, const float* values, size_t count, float offset, float scale) {
+    int64_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        // 0 marks a gap; the next step is taken from the last real sample
+        if (!std::isfinite(values[i])) {
+            appendVarint(out, 0);
+            continue;
+        }
+        int64_t step = llroundf((values[i] - offset) / scale);
+        int64_t delta = step - previous;
+        appendVarint(out, (((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63)) + 1);
+        previous = step;
+    }
+}
+
+String DashboardCodec::base64Encode(const uint8_t* data, size_t length) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    String encoded;
+    encoded.reserve((length + 2) / 3 * 4);
+
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t chunk = (uint32_t)data[i] << 16;
+        if (i + 1 < length) chunk |= (uint32_t)data[i + 1] << 8;
+        if (i + 2 < length) chunk |= data[i + 2];
+
+        encoded += alphabet[(chunk >> 18) & 0x3F];
+        encoded += alphabet[(chunk >> 12) & 0x3F];
+        encoded += i + 1 < length ? alphabet[(chunk >> 6) & 0x3F] : '=';
+        encoded += i + 2 < length ? alphabet[chunk & 0x3F] : '=';
+    }
+
+    return encoded;
+}
@@ -0,0 +1,25 @@
+#ifndef DASHBOARDCODEC_H
+#define DASHBOARDCODEC_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Compact binary encodings shared by chart and capture frames.
+// Byte blocks travel inside JSON frames as base64.
+class DashboardCodec {
+public:
+	// LEB128-style unsigned varint and its zigzag-mapped signed variant
+	static void appendVarint(std::vector<uint8_t>& out, uint64_t value);
+	static void appendZigZag(std::vector<uint8_t>& out, int64_t value);
+	static uint64_t readVarint(const uint8_t*& in);
+	static int64_t readZigZag(const uint8_t*& in);
+
+	// Quantizes values to round((v - offset) / scale) and stores the
+	// differences between consecutive steps as zigzag varints + 1; a
+	// non-finite value is stored as 0 (a gap)
+	static void appendQuantizedDeltas(std::vector<uint8_t>& out, const float* values, size_t count, float offset, float scale);
+
+	static String base64Encode(const uint8_t* data, size_t length);
+};
+
+#endif
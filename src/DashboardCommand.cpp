@@ -0,0 +1,30 @@
+#include "DashboardCommand.h"
+#include <string.h>
+
+bool decodeDashboardCommand(const uint8_t* payload, size_t length, DashboardCommand& command) {
+    if (length != sizeof(DashboardCommand) || payload[0] != DASHBOARD_COMMAND_MAGIC) return false;
+
+    // The ESP32 is little-endian, so the frame maps onto the struct as is
+    memcpy(&command, payload, sizeof(DashboardCommand));
+    return commandActionName(command.opcode) != nullptr;
+}
+
+const char* commandActionName(uint8_t opcode) {
+    switch (opcode) {
+    case COMMAND_TOGGLE: return "toggle";
+    case COMMAND_CLICK: return "click";
+    case COMMAND_SLIDE: return "slide";
+    case COMMAND_MOVE: return "move";
+    case COMMAND_SET: return "set";
+    default: return nullptr;
+    }
+}
+
+uint8_t commandOpcode(const String& action) {
+    if (action == "toggle") return COMMAND_TOGGLE;
+    if (action == "click") return COMMAND_CLICK;
+    if (action == "slide") return COMMAND_SLIDE;
+    if (action == "move") return COMMAND_MOVE;
+    if (action == "set") return COMMAND_SET;
+    return 0;
+}
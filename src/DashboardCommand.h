@@ -0,0 +1,43 @@
+#ifndef DASHBOARDCOMMAND_H
+#define DASHBOARDCOMMAND_H
+
+#include <Arduino.h>
+
+// Wire format of a binary control command, sent as a WebSocket binary
+// frame. Controls are addressed by their handle (see /api/layout), which
+// stays the same for the life of the control; multi-byte fields are
+// little-endian. A move carries two axes in place of the float value,
+// each a signed 16-bit fraction of DASHBOARD_COMMAND_AXIS_SCALE.
+#define DASHBOARD_COMMAND_MAGIC 0xDC
+#define DASHBOARD_COMMAND_AXIS_SCALE 32767
+
+enum CommandOpcode {
+	COMMAND_TOGGLE = 1,
+	COMMAND_CLICK = 2,
+	COMMAND_SLIDE = 3,
+	COMMAND_MOVE = 4,
+	COMMAND_SET = 5
+};
+
+struct __attribute__((packed)) DashboardCommand {
+	uint8_t magic;
+	uint8_t opcode;
+	uint16_t handle;
+	union {
+		float value;
+		struct __attribute__((packed)) {
+			int16_t x;
+			int16_t y;
+		} axes;
+	};
+};
+
+// Validates and copies a frame into command; never allocates
+bool decodeDashboardCommand(const uint8_t* payload, size_t length, DashboardCommand& command);
+
+// Maps between opcodes and the action names of the JSON protocol;
+// commandOpcode() returns 0 for an unknown action
+const char* commandActionName(uint8_t opcode);
+uint8_t commandOpcode(const String& action);
+
+#endif
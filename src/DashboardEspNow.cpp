@@ -0,0 +1,99 @@
+#include "DashboardEspNow.h"
+
+// Enough to ride out a few slow loop() iterations while several nodes report
+static const uint32_t QUEUE_SIZE = 16;
+
+DashboardEspNow* DashboardEspNow::instance = nullptr;
+
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
+void DashboardEspNow::onReceive(const esp_now_recv_info_t* info, const uint8_t* data, int length) {
+    const uint8_t* mac = info->src_addr;
+#else
+void DashboardEspNow::onReceive(const uint8_t* mac, const uint8_t* data, int length) {
+#endif
+    if (instance) instance->push(mac, data, length);
+}
+
+DashboardEspNow::DashboardEspNow() {
+    queue = nullptr;
+    head = 0;
+    tail = 0;
+    dropped = 0;
+    running = false;
+}
+
+DashboardEspNow::~DashboardEspNow() {
+    end();
+    delete[] queue;
+}
+
+bool DashboardEspNow::begin() {
+    if (running) return true;
+    if (instance) return false;
+
+    if (!queue) queue = new Entry[QUEUE_SIZE];
+    head = 0;
+    tail = 0;
+    dropped = 0;
+
+    if (esp_now_init() != ESP_OK) return false;
+    instance = this;
+    if (esp_now_register_recv_cb(&DashboardEspNow::onReceive) != ESP_OK) {
+        instance = nullptr;
+        esp_now_deinit();
+        return false;
+    }
+
+    running = true;
+    return true;
+}
+
+void DashboardEspNow::end() {
+    if (!running) return;
+
+    esp_now_unregister_recv_cb();
+    esp_now_deinit();
+    instance = nullptr;
+    running = false;
+}
+
+bool DashboardEspNow::isRunning() const {
+    return running;
+}
+
+void DashboardEspNow::push(const uint8_t* mac, const uint8_t* data, int length) {
+    // Anything that is not a complete dashboard packet is ignored here
+    const size_t headerSize = dashboardEspNowPacketSize(0);
+    if (length < (int)headerSize || data[0] != DASHBOARD_ESPNOW_MAGIC) return;
+    uint8_t count = data[1];
+    if (count > DASHBOARD_ESPNOW_MAX_READINGS || (size_t)length < dashboardEspNowPacketSize(count)) return;
+
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= QUEUE_SIZE) {
+        dropped++;
+        return;
+    }
+
+    Entry& entry = queue[h % QUEUE_SIZE];
+    memcpy(entry.mac, mac, sizeof(entry.mac));
+    memcpy(&entry.packet, data, dashboardEspNowPacketSize(count));
+    head.store(h + 1, std::memory_order_release);
+}
+
+size_t DashboardEspNow::drain(std::function<void(const uint8_t* mac, const DashboardEspNowPacket& packet)> handler) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+
+    size_t count = h - t;
+    for (; t != h; t++) {
+        Entry& entry = queue[t % QUEUE_SIZE];
+        handler(entry.mac, entry.packet);
+    }
+    tail.store(t, std::memory_order_release);
+
+    return count;
+}
+
+uint32_t DashboardEspNow::getDropped() const {
+    return dropped;
+}
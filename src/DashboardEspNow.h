@@ -0,0 +1,70 @@
+#ifndef DASHBOARDESPNOW_H
+#define DASHBOARDESPNOW_H
+
+#include <Arduino.h>
+#include <esp_now.h>
+#include <atomic>
+#include <functional>
+
+// Wire format of a sensor node packet, shared with the sender sketches.
+// A node batches up to DASHBOARD_ESPNOW_MAX_READINGS readings into one
+// packet and sends dashboardEspNowPacketSize(count) bytes of it.
+#define DASHBOARD_ESPNOW_MAGIC 0xDB
+#define DASHBOARD_ESPNOW_MAX_READINGS 48
+
+struct __attribute__((packed)) DashboardEspNowReading {
+	uint8_t channel;
+	float value;
+};
+
+struct __attribute__((packed)) DashboardEspNowPacket {
+	uint8_t magic;
+	uint8_t count;
+	uint16_t sequence;
+	DashboardEspNowReading readings[DASHBOARD_ESPNOW_MAX_READINGS];
+};
+
+inline size_t dashboardEspNowPacketSize(uint8_t count) {
+	return sizeof(DashboardEspNowPacket) - sizeof(DashboardEspNowReading) * (DASHBOARD_ESPNOW_MAX_READINGS - count);
+}
+
+// ESP-NOW receiver for sensor node packets.
+// The receive callback runs in the Wi-Fi task, so it only validates and
+// copies packets into a single-producer / single-consumer queue that loop()
+// drains. Packets that find the queue full are counted as dropped.
+class DashboardEspNow {
+private:
+	struct Entry {
+		uint8_t mac[6];
+		DashboardEspNowPacket packet;
+	};
+
+	Entry* queue;
+	std::atomic<uint32_t> head;
+	std::atomic<uint32_t> tail;
+	std::atomic<uint32_t> dropped;
+	bool running;
+
+	// ESP-NOW has a single receive callback per device
+	static DashboardEspNow* instance;
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
+	static void onReceive(const esp_now_recv_info_t* info, const uint8_t* data, int length);
+#else
+	static void onReceive(const uint8_t* mac, const uint8_t* data, int length);
+#endif
+	void push(const uint8_t* mac, const uint8_t* data, int length);
+
+public:
+	DashboardEspNow();
+	~DashboardEspNow();
+
+	// Wi-Fi must be up; sensor nodes have to send on the access point's channel
+	bool begin();
+	void end();
+	bool isRunning() const;
+
+	size_t drain(std::function<void(const uint8_t* mac, const DashboardEspNowPacket& packet)> handler);
+	uint32_t getDropped() const;
+};
+
+#endif
@@ -0,0 +1,86 @@
+#include "DashboardFilter.h"
+#include <algorithm>
+
+DashboardFilter::DashboardFilter() {
+    type = FILTER_NONE;
+    alpha = 1.0;
+    average = 0;
+    head = 0;
+    count = 0;
+}
+
+void DashboardFilter::configure(FilterType type, int window) {
+    if (window < 1) window = 1;
+
+    this->type = type;
+    alpha = 2.0 / (window + 1);
+
+    this->window.clear();
+    scratch.clear();
+    if (type == FILTER_MEAN || type == FILTER_MIN || type == FILTER_MAX || type == FILTER_MEDIAN) {
+        this->window.resize(window);
+    }
+    if (type == FILTER_MEDIAN) {
+        scratch.reserve(window);
+    }
+
+    reset();
+}
+
+void DashboardFilter::reset() {
+    average = 0;
+    head = 0;
+    count = 0;
+}
+
+void DashboardFilter::addSample(float sample) {
+    if (type == FILTER_NONE) {
+        average = sample;
+        count = 1;
+        return;
+    }
+
+    if (type == FILTER_EMA) {
+        average = count == 0 ? sample : average + alpha * (sample - average);
+        count = 1;
+        return;
+    }
+
+    window[head] = sample;
+    head = (head + 1) % window.size();
+    if (count < window.size()) count++;
+}
+
+bool DashboardFilter::hasValue() const {
+    return count > 0;
+}
+
+float DashboardFilter::value() const {
+    if (count == 0) return 0;
+    if (type == FILTER_NONE || type == FILTER_EMA) return average;
+
+    // Sample order does not matter for these aggregates, and until the ring
+    // wraps the samples occupy window[0..count)
+    if (type == FILTER_MEDIAN) {
+        scratch.assign(window.begin(), window.begin() + count);
+        auto middle = scratch.begin() + count / 2;
+        std::nth_element(scratch.begin(), middle, scratch.end());
+        if (count % 2 == 1) return *middle;
+        float upper = *middle;
+        float lower = *std::max_element(scratch.begin(), middle);
+        return (lower + upper) / 2;
+    }
+
+    float result = window[0];
+    for (size_t i = 1; i < count; i++) {
+        if (type == FILTER_MEAN) result += window[i];
+        else if (type == FILTER_MIN) result = std::min(result, window[i]);
+        else if (type == FILTER_MAX) result = std::max(result, window[i]);
+    }
+
+    return type == FILTER_MEAN ? result / count : result;
+}
+
+FilterType DashboardFilter::getType() const {
+    return type;
+}
@@ -0,0 +1,44 @@
+#ifndef DASHBOARDFILTER_H
+#define DASHBOARDFILTER_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Filter types
+enum FilterType {
+	FILTER_NONE,
+	FILTER_EMA,
+	FILTER_MEAN,
+	FILTER_MIN,
+	FILTER_MAX,
+	FILTER_MEDIAN
+};
+
+// Smoothing/aggregation filter for a numeric card.
+// addSample() is O(1) so it can run at the sampling rate; value() does the
+// window work and is only called once per dashboard update.
+class DashboardFilter {
+private:
+	FilterType type;
+	float alpha;
+	float average;
+	std::vector<float> window;
+	mutable std::vector<float> scratch;
+	size_t head;
+	size_t count;
+
+public:
+	DashboardFilter();
+
+	// window is the number of samples kept; for EMA it sets the smoothing
+	// factor as in an N-period EMA (alpha = 2 / (window + 1))
+	void configure(FilterType type, int window);
+	void reset();
+
+	void addSample(float sample);
+	bool hasValue() const;
+	float value() const;
+	FilterType getType() const;
+};
+
+#endif
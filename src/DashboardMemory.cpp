@@ -0,0 +1,121 @@
+#include "DashboardMemory.h"
+#include <cstddef>
+#include <cstdlib>
+
+// A shrinking trend below this rate is treated as noise
+static const float SHRINK_THRESHOLD = 1024;
+
+DashboardMemory::Usage DashboardMemory::usage[MEMORY_SUBSYSTEM_COUNT] = {};
+
+DashboardMemory::DashboardMemory() {
+    sampleCount = 0;
+    sampleHead = 0;
+}
+
+void DashboardMemory::allocated(MemorySubsystem subsystem, size_t bytes) {
+    Usage& entry = usage[subsystem];
+    entry.current += bytes;
+    entry.allocations++;
+    if (entry.current > entry.peak) entry.peak = entry.current;
+}
+
+void DashboardMemory::released(MemorySubsystem subsystem, size_t bytes) {
+    Usage& entry = usage[subsystem];
+    entry.current = entry.current > bytes ? entry.current - bytes : 0;
+}
+
+void DashboardMemory::measured(MemorySubsystem subsystem, size_t bytes) {
+    Usage& entry = usage[subsystem];
+    entry.current = bytes;
+    if (bytes > entry.peak) entry.peak = bytes;
+}
+
+size_t DashboardMemory::getCurrent(MemorySubsystem subsystem) {
+    return usage[subsystem].current;
+}
+
+size_t DashboardMemory::getPeak(MemorySubsystem subsystem) {
+    return usage[subsystem].peak;
+}
+
+uint32_t DashboardMemory::getAllocations(MemorySubsystem subsystem) {
+    return usage[subsystem].allocations;
+}
+
+const char* DashboardMemory::name(MemorySubsystem subsystem) {
+    switch (subsystem) {
+    case MEMORY_JSON: return "json";
+    case MEMORY_FRAMES: return "frames";
+    case MEMORY_CHARTS: return "charts";
+    case MEMORY_RECORDER: return "recorder";
+    default: return "";
+    }
+}
+
+void DashboardMemory::sampleLargestBlock(uint32_t bytes) {
+    heapSamples[sampleHead] = bytes;
+    sampleHead = (sampleHead + 1) % HEAP_SAMPLES;
+    if (sampleCount < HEAP_SAMPLES) sampleCount++;
+}
+
+float DashboardMemory::getLargestBlockTrend() const {
+    if (sampleCount < 2) return 0;
+
+    // Least-squares slope, x = sample number (oldest first)
+    int oldest = (sampleHead - sampleCount + HEAP_SAMPLES) % HEAP_SAMPLES;
+    float meanX = (sampleCount - 1) / 2.0;
+    float meanY = 0;
+    for (int i = 0; i < sampleCount; i++) meanY += heapSamples[(oldest + i) % HEAP_SAMPLES];
+    meanY /= sampleCount;
+
+    float covariance = 0;
+    float variance = 0;
+    for (int i = 0; i < sampleCount; i++) {
+        float dx = i - meanX;
+        covariance += dx * (heapSamples[(oldest + i) % HEAP_SAMPLES] - meanY);
+        variance += dx * dx;
+    }
+
+    // bytes per sample -> bytes per hour
+    return covariance / variance * (3600000.0 / SAMPLE_INTERVAL);
+}
+
+bool DashboardMemory::isLargestBlockShrinking() const {
+    // Judge only a full window, and only if the block really got smaller
+    if (sampleCount < HEAP_SAMPLES) return false;
+    int oldest = sampleHead;
+    int newest = (sampleHead - 1 + HEAP_SAMPLES) % HEAP_SAMPLES;
+    return heapSamples[newest] < heapSamples[oldest] && getLargestBlockTrend() < -SHRINK_THRESHOLD;
+}
+
+// Each block carries its size in front so deallocate() can account it
+static const size_t HEADER_SIZE = alignof(std::max_align_t) > sizeof(size_t) ? alignof(std::max_align_t) : sizeof(size_t);
+
+void* DashboardJsonAllocator::allocate(size_t size) {
+    uint8_t* block = (uint8_t*)malloc(size + HEADER_SIZE);
+    if (!block) return nullptr;
+    *(size_t*)block = size;
+    DashboardMemory::allocated(MEMORY_JSON, size);
+    return block + HEADER_SIZE;
+}
+
+void DashboardJsonAllocator::deallocate(void* pointer) {
+    if (!pointer) return;
+    uint8_t* block = (uint8_t*)pointer - HEADER_SIZE;
+    DashboardMemory::released(MEMORY_JSON, *(size_t*)block);
+    free(block);
+}
+
+void* DashboardJsonAllocator::reallocate(void* pointer, size_t newSize) {
+    if (!pointer) return allocate(newSize);
+
+    // Documents shrink to fit on their way out; account the size change only
+    uint8_t* block = (uint8_t*)pointer - HEADER_SIZE;
+    size_t oldSize = *(size_t*)block;
+    uint8_t* resized = (uint8_t*)realloc(block, newSize + HEADER_SIZE);
+    if (!resized) return nullptr;
+    *(size_t*)resized = newSize;
+    DashboardMemory::released(MEMORY_JSON, oldSize);
+    DashboardMemory::measured(MEMORY_JSON, DashboardMemory::getCurrent(MEMORY_JSON) + newSize);
+    return resized + HEADER_SIZE;
+}
@@ -0,0 +1,63 @@
+#ifndef DASHBOARDMEMORY_H
+#define DASHBOARDMEMORY_H
+
+#include <Arduino.h>
+
+// Memory accounted to each part of the dashboard
+enum MemorySubsystem {
+	MEMORY_JSON,
+	MEMORY_FRAMES,
+	MEMORY_CHARTS,
+	MEMORY_RECORDER,
+	MEMORY_SUBSYSTEM_COUNT
+};
+
+// Per-subsystem memory accounting and a trend of the largest free heap
+// block. JSON documents are tracked exactly through DashboardJsonAllocator,
+// frames while they are in flight, and longer-lived structures (charts,
+// recorder) are measured in place. Counters are static because ArduinoJson
+// allocators are stateless.
+class DashboardMemory {
+private:
+	struct Usage {
+		size_t current;
+		size_t peak;
+		uint32_t allocations;
+	};
+
+	static Usage usage[MEMORY_SUBSYSTEM_COUNT];
+
+	static const int HEAP_SAMPLES = 60;
+	uint32_t heapSamples[HEAP_SAMPLES];
+	int sampleCount;
+	int sampleHead;
+
+public:
+	static const unsigned long SAMPLE_INTERVAL = 60000;
+
+	DashboardMemory();
+
+	static void allocated(MemorySubsystem subsystem, size_t bytes);
+	static void released(MemorySubsystem subsystem, size_t bytes);
+	static void measured(MemorySubsystem subsystem, size_t bytes);
+
+	static size_t getCurrent(MemorySubsystem subsystem);
+	static size_t getPeak(MemorySubsystem subsystem);
+	static uint32_t getAllocations(MemorySubsystem subsystem);
+	static const char* name(MemorySubsystem subsystem);
+
+	// Largest free block, sampled every SAMPLE_INTERVAL by the owner; the
+	// trend is a least-squares slope over the last HEAP_SAMPLES samples
+	void sampleLargestBlock(uint32_t bytes);
+	float getLargestBlockTrend() const;
+	bool isLargestBlockShrinking() const;
+};
+
+// ArduinoJson allocator that accounts every document to MEMORY_JSON
+struct DashboardJsonAllocator {
+	void* allocate(size_t size);
+	void deallocate(void* pointer);
+	void* reallocate(void* pointer, size_t newSize);
+};
+
+#endif
@@ -0,0 +1,245 @@
+#include "DashboardModbus.h"
+
+// Function codes
+static const uint8_t READ_COILS = 0x01;
+static const uint8_t READ_HOLDING_REGISTERS = 0x03;
+static const uint8_t READ_INPUT_REGISTERS = 0x04;
+static const uint8_t WRITE_SINGLE_COIL = 0x05;
+static const uint8_t WRITE_SINGLE_REGISTER = 0x06;
+static const uint8_t WRITE_MULTIPLE_COILS = 0x0F;
+static const uint8_t WRITE_MULTIPLE_REGISTERS = 0x10;
+
+// Exception codes
+static const uint8_t ILLEGAL_FUNCTION = 0x01;
+static const uint8_t ILLEGAL_DATA_ADDRESS = 0x02;
+static const uint8_t ILLEGAL_DATA_VALUE = 0x03;
+
+static const size_t MBAP_SIZE = 7;
+
+static uint16_t readWord(const uint8_t* data) {
+    return (uint16_t)(data[0] << 8 | data[1]);
+}
+
+static void writeWord(uint8_t* data, uint16_t value) {
+    data[0] = value >> 8;
+    data[1] = value & 0xFF;
+}
+
+static bool isSupported(uint8_t function) {
+    switch (function) {
+    case READ_COILS:
+    case READ_HOLDING_REGISTERS:
+    case READ_INPUT_REGISTERS:
+    case WRITE_SINGLE_COIL:
+    case WRITE_SINGLE_REGISTER:
+    case WRITE_MULTIPLE_COILS:
+    case WRITE_MULTIPLE_REGISTERS:
+        return true;
+    }
+    return false;
+}
+
+// The last address of a range must not wrap past 0xFFFF
+static bool fitsAddressSpace(uint16_t address, uint16_t quantity) {
+    return (uint32_t)address + quantity <= 0x10000;
+}
+
+DashboardModbus::DashboardModbus() {
+    server = nullptr;
+    for (int i = 0; i < MAX_CLIENTS; i++) buffered[i] = 0;
+    requests = 0;
+    exceptions = 0;
+}
+
+DashboardModbus::~DashboardModbus() {
+    for (int i = 0; i < MAX_CLIENTS; i++) clients[i].stop();
+    delete server;
+}
+
+void DashboardModbus::begin(uint16_t port) {
+    if (server) return;
+    server = new WiFiServer(port);
+    server->begin();
+    server->setNoDelay(true);
+}
+
+void DashboardModbus::loop() {
+    if (!server) return;
+
+    acceptClients();
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+        if (clients[i] && clients[i].connected()) serviceClient(i);
+    }
+}
+
+void DashboardModbus::acceptClients() {
+    while (server->hasClient()) {
+        WiFiClient client = server->available();
+        int slot = -1;
+        for (int i = 0; i < MAX_CLIENTS && slot < 0; i++) {
+            if (!clients[i] || !clients[i].connected()) slot = i;
+        }
+        if (slot < 0) {
+            // All slots busy: SCADA masters reconnect, so refuse rather than queue
+            client.stop();
+            continue;
+        }
+        clients[slot].stop();
+        clients[slot] = client;
+        clients[slot].setNoDelay(true);
+        buffered[slot] = 0;
+    }
+}
+
+void DashboardModbus::serviceClient(int index) {
+    WiFiClient& client = clients[index];
+    uint8_t* buffer = buffers[index];
+
+    while (client.available() > 0) {
+        int count = client.read(buffer + buffered[index], MAX_ADU - buffered[index]);
+        if (count <= 0) break;
+        buffered[index] += count;
+
+        // Several pipelined requests may have arrived together
+        while (buffered[index] >= MBAP_SIZE) {
+            size_t frameLength = 6 + readWord(buffer + 4);
+            if (frameLength > MAX_ADU || frameLength < MBAP_SIZE + 1) {
+                // Lost framing; there is no way to resynchronize a TCP stream
+                client.stop();
+                buffered[index] = 0;
+                return;
+            }
+            if (buffered[index] < frameLength) break;
+
+            size_t responseLength = handleFrame(buffer, frameLength, response);
+            if (responseLength > 0) client.write(response, responseLength);
+
+            buffered[index] -= frameLength;
+            memmove(buffer, buffer + frameLength, buffered[index]);
+        }
+    }
+}
+
+size_t DashboardModbus::handleFrame(const uint8_t* frame, size_t length, uint8_t* out) {
+    // MBAP: transaction id, protocol id (0), length, unit id
+    if (length < MBAP_SIZE + 1 || readWord(frame + 2) != 0) return 0;
+    if (6 + (size_t)readWord(frame + 4) != length) return 0;
+
+    requests++;
+    size_t pduLength = handlePdu(frame + MBAP_SIZE, length - MBAP_SIZE, out + MBAP_SIZE);
+
+    memcpy(out, frame, 4);
+    writeWord(out + 4, pduLength + 1);
+    out[6] = frame[6];
+    return MBAP_SIZE + pduLength;
+}
+
+size_t DashboardModbus::exception(uint8_t function, uint8_t code, uint8_t* out) {
+    exceptions++;
+    out[0] = function | 0x80;
+    out[1] = code;
+    return 2;
+}
+
+template <typename T>
+bool DashboardModbus::isMapped(const std::function<bool(uint16_t, T&)>& reader, uint16_t address, uint16_t quantity) {
+    if (!reader) return false;
+    for (uint16_t i = 0; i < quantity; i++) {
+        T value;
+        if (!reader(address + i, value)) return false;
+    }
+    return true;
+}
+
+size_t DashboardModbus::handlePdu(const uint8_t* pdu, size_t length, uint8_t* out) {
+    // An unsupported function is reported as such, whatever its length
+    uint8_t function = pdu[0];
+    if (!isSupported(function)) return exception(function, ILLEGAL_FUNCTION, out);
+    if (length < 5) return exception(function, ILLEGAL_DATA_VALUE, out);
+
+    uint16_t address = readWord(pdu + 1);
+    uint16_t quantity = readWord(pdu + 3);
+    out[0] = function;
+
+    switch (function) {
+    case READ_COILS: {
+        if (quantity < 1 || quantity > 2000) return exception(function, ILLEGAL_DATA_VALUE, out);
+        if (!fitsAddressSpace(address, quantity)) return exception(function, ILLEGAL_DATA_ADDRESS, out);
+        uint8_t bytes = (quantity + 7) / 8;
+        out[1] = bytes;
+        memset(out + 2, 0, bytes);
+        for (uint16_t i = 0; i < quantity; i++) {
+            bool value = false;
+            if (!readCoil || !readCoil(address + i, value)) return exception(function, ILLEGAL_DATA_ADDRESS, out);
+            if (value) out[2 + i / 8] |= 1 << (i % 8);
+        }
+        return 2 + bytes;
+    }
+
+    case READ_HOLDING_REGISTERS:
+    case READ_INPUT_REGISTERS: {
+        if (quantity < 1 || quantity > 125) return exception(function, ILLEGAL_DATA_VALUE, out);
+        if (!fitsAddressSpace(address, quantity)) return exception(function, ILLEGAL_DATA_ADDRESS, out);
+        auto& reader = function == READ_HOLDING_REGISTERS ? readHoldingRegister : readInputRegister;
+        out[1] = quantity * 2;
+        for (uint16_t i = 0; i < quantity; i++) {
+            uint16_t value = 0;
+            if (!reader || !reader(address + i, value)) return exception(function, ILLEGAL_DATA_ADDRESS, out);
+            writeWord(out + 2 + i * 2, value);
+        }
+        return 2 + quantity * 2;
+    }
+
+    case WRITE_SINGLE_COIL: {
+        // quantity holds the value here: 0xFF00 = on, 0x0000 = off
+        if (quantity != 0xFF00 && quantity != 0x0000) return exception(function, ILLEGAL_DATA_VALUE, out);
+        if (!writeCoil || !writeCoil(address, quantity == 0xFF00)) return exception(function, ILLEGAL_DATA_ADDRESS, out);
+        memcpy(out, pdu, 5);
+        return 5;
+    }
+
+    case WRITE_SINGLE_REGISTER: {
+        if (!writeHoldingRegister || !writeHoldingRegister(address, quantity)) return exception(function, ILLEGAL_DATA_ADDRESS, out);
+        memcpy(out, pdu, 5);
+        return 5;
+    }
+
+    case WRITE_MULTIPLE_COILS: {
+        if (length < 6 || quantity < 1 || quantity > 1968 || pdu[5] != (quantity + 7) / 8 || length < 6 + (size_t)pdu[5]) {
+            return exception(function, ILLEGAL_DATA_VALUE, out);
+        }
+        if (!fitsAddressSpace(address, quantity) || !isMapped(readCoil, address, quantity)) return exception(function, ILLEGAL_DATA_ADDRESS, out);
+        for (uint16_t i = 0; i < quantity; i++) {
+            bool value = pdu[6 + i / 8] & (1 << (i % 8));
+            if (!writeCoil || !writeCoil(address + i, value)) return exception(function, ILLEGAL_DATA_ADDRESS, out);
+        }
+        memcpy(out, pdu, 5);
+        return 5;
+    }
+
+    case WRITE_MULTIPLE_REGISTERS: {
+        if (length < 6 || quantity < 1 || quantity > 123 || pdu[5] != quantity * 2 || length < 6 + (size_t)pdu[5]) {
+            return exception(function, ILLEGAL_DATA_VALUE, out);
+        }
+        if (!fitsAddressSpace(address, quantity) || !isMapped(readHoldingRegister, address, quantity)) return exception(function, ILLEGAL_DATA_ADDRESS, out);
+        for (uint16_t i = 0; i < quantity; i++) {
+            if (!writeHoldingRegister || !writeHoldingRegister(address + i, readWord(pdu + 6 + i * 2))) {
+                return exception(function, ILLEGAL_DATA_ADDRESS, out);
+            }
+        }
+        memcpy(out, pdu, 5);
+        return 5;
+    }
+
+    default:
+        return exception(function, ILLEGAL_FUNCTION, out);
+    }
+}
+
+uint32_t DashboardModbus::getRequests() const {
+    return requests;
+}
+
+uint32_t DashboardModbus::getExceptions() const {
+    return exceptions;
+}
@@ -0,0 +1,57 @@
+#ifndef DASHBOARDMODBUS_H
+#define DASHBOARDMODBUS_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <functional>
+
+// Modbus TCP server (function codes 1, 3, 4, 5, 6, 15 and 16).
+// Only frames the protocol; the register map is supplied through the
+// read/write callbacks, which return false for an unmapped address. Coils
+// and holding registers are read and written at the same addresses, so
+// multiple writes check the whole range with the read callbacks and either
+// apply all of it or none. Requests are answered from fixed per-client
+// buffers without allocating.
+class DashboardModbus {
+public:
+	static const int MAX_CLIENTS = 4;
+	static const size_t MAX_ADU = 260;
+
+private:
+	WiFiServer* server;
+	WiFiClient clients[MAX_CLIENTS];
+	uint8_t buffers[MAX_CLIENTS][MAX_ADU];
+	size_t buffered[MAX_CLIENTS];
+	uint8_t response[MAX_ADU];
+	uint32_t requests;
+	uint32_t exceptions;
+
+	void acceptClients();
+	void serviceClient(int index);
+	size_t handlePdu(const uint8_t* pdu, size_t length, uint8_t* out);
+	size_t exception(uint8_t function, uint8_t code, uint8_t* out);
+	template <typename T>
+	bool isMapped(const std::function<bool(uint16_t, T&)>& reader, uint16_t address, uint16_t quantity);
+
+public:
+	DashboardModbus();
+	~DashboardModbus();
+
+	void begin(uint16_t port = 502);
+	void loop();
+
+	// Processes one complete request ADU (MBAP header + PDU) into out and
+	// returns the response length; 0 means the frame gets no answer
+	size_t handleFrame(const uint8_t* frame, size_t length, uint8_t* out);
+
+	uint32_t getRequests() const;
+	uint32_t getExceptions() const;
+
+	std::function<bool(uint16_t address, bool& value)> readCoil;
+	std::function<bool(uint16_t address, uint16_t& value)> readHoldingRegister;
+	std::function<bool(uint16_t address, uint16_t& value)> readInputRegister;
+	std::function<bool(uint16_t address, bool value)> writeCoil;
+	std::function<bool(uint16_t address, uint16_t value)> writeHoldingRegister;
+};
+
+#endif
@@ -0,0 +1,73 @@
+#include "DashboardMqtt.h"
+
+bool DashboardMqttTransport::topicMatches(const String& filter, const String& topic) {
+    int f = 0;
+    int t = 0;
+    while (f < (int)filter.length()) {
+        if (filter[f] == '#') return true;
+
+        int filterEnd = filter.indexOf('/', f);
+        if (filterEnd < 0) filterEnd = filter.length();
+        if (t > (int)topic.length()) return false;
+        int topicEnd = topic.indexOf('/', t);
+        if (topicEnd < 0) topicEnd = topic.length();
+
+        bool wildcard = filterEnd - f == 1 && filter[f] == '+';
+        if (!wildcard && filter.substring(f, filterEnd) != topic.substring(t, topicEnd)) return false;
+
+        f = filterEnd + 1;
+        t = topicEnd + 1;
+    }
+    return t > (int)topic.length();
+}
+
+DashboardMqttLoopback::DashboardMqttLoopback() {
+    online = false;
+}
+
+bool DashboardMqttLoopback::connect() {
+    online = true;
+    return true;
+}
+
+bool DashboardMqttLoopback::connected() {
+    return online;
+}
+
+void DashboardMqttLoopback::loop() {
+}
+
+bool DashboardMqttLoopback::publish(const String& topic, const String& payload, bool retain) {
+    if (!online) return false;
+    published.push_back({ topic, payload, retain });
+    return true;
+}
+
+bool DashboardMqttLoopback::subscribe(const String& filter) {
+    if (!online) return false;
+    subscriptions.push_back(filter);
+    return true;
+}
+
+bool DashboardMqttLoopback::inject(const String& topic, const String& payload) {
+    if (!online || !onMessage) return false;
+    for (auto& filter : subscriptions) {
+        if (topicMatches(filter, topic)) {
+            onMessage(topic, payload);
+            return true;
+        }
+    }
+    return false;
+}
+
+String DashboardMqttLoopback::retained(const String& topic) const {
+    for (auto it = published.rbegin(); it != published.rend(); ++it) {
+        if (it->retain && it->topic == topic) return it->payload;
+    }
+    return "";
+}
+
+void DashboardMqttLoopback::disconnect() {
+    online = false;
+    subscriptions.clear();
+}
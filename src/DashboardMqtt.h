@@ -0,0 +1,59 @@
+#ifndef DASHBOARDMQTT_H
+#define DASHBOARDMQTT_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+// What the MQTT bridge needs from a client library. Adapters implement it
+// for a real client (see DashboardMqttPubSub.h); DashboardMqttLoopback is
+// an in-memory stand-in for a broker.
+class DashboardMqttTransport {
+public:
+	virtual ~DashboardMqttTransport() {}
+
+	virtual bool connect() = 0;
+	virtual bool connected() = 0;
+	virtual void loop() = 0;
+	virtual bool publish(const String& topic, const String& payload, bool retain) = 0;
+	virtual bool subscribe(const String& filter) = 0;
+
+	// Set by the bridge; adapters call it for every incoming message
+	std::function<void(const String& topic, const String& payload)> onMessage;
+
+	// MQTT filter matching with the + and # wildcards
+	static bool topicMatches(const String& filter, const String& topic);
+};
+
+// Broker stand-in that keeps everything in memory: records what the bridge
+// publishes (and the retained value per topic) and delivers injected
+// messages to matching subscriptions. Useful to exercise the bridge without
+// a network.
+class DashboardMqttLoopback : public DashboardMqttTransport {
+public:
+	struct Message {
+		String topic;
+		String payload;
+		bool retain;
+	};
+
+	std::vector<Message> published;
+	std::vector<String> subscriptions;
+	bool online;
+
+	DashboardMqttLoopback();
+
+	bool connect() override;
+	bool connected() override;
+	void loop() override;
+	bool publish(const String& topic, const String& payload, bool retain) override;
+	bool subscribe(const String& filter) override;
+
+	// Simulates a message from another client; false if nothing subscribed
+	bool inject(const String& topic, const String& payload);
+	// Last retained payload of a topic, empty if none
+	String retained(const String& topic) const;
+	void disconnect();
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef DASHBOARDMQTTPUBSUB_H
+#define DASHBOARDMQTTPUBSUB_H
+
+#include <PubSubClient.h>
+#include "DashboardMqtt.h"
+
+// MQTT bridge transport over the PubSubClient library. Header-only so the
+// dashboard does not depend on PubSubClient unless a sketch includes this.
+// Card payloads are small, but keep PubSubClient's buffer (256 bytes by
+// default) above the longest topic + payload.
+class DashboardMqttPubSub : public DashboardMqttTransport {
+private:
+	PubSubClient& client;
+	String clientId;
+	String user;
+	String password;
+
+public:
+	DashboardMqttPubSub(PubSubClient& client, const char* clientId, const char* user = "", const char* password = "")
+		: client(client), clientId(clientId), user(user), password(password) {
+	}
+
+	bool connect() override {
+		client.setCallback([this](char* topic, uint8_t* payload, unsigned int length) {
+			// PubSubClient reuses its buffer for publishing, so copy first
+			String text;
+			text.reserve(length);
+			for (unsigned int i = 0; i < length; i++) text += (char)payload[i];
+			if (onMessage) onMessage(String(topic), text);
+		});
+		if (user.length() > 0) return client.connect(clientId.c_str(), user.c_str(), password.c_str());
+		return client.connect(clientId.c_str());
+	}
+
+	bool connected() override {
+		return client.connected();
+	}
+
+	void loop() override {
+		client.loop();
+	}
+
+	bool publish(const String& topic, const String& payload, bool retain) override {
+		return client.publish(topic.c_str(), payload.c_str(), retain);
+	}
+
+	bool subscribe(const String& filter) override {
+		return client.subscribe(filter.c_str());
+	}
+};
+
+#endif
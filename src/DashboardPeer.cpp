@@ -0,0 +1,147 @@
+#include "DashboardPeer.h"
+#include <algorithm>
+
+static const unsigned long RECONNECT_INTERVAL = 5000;
+static const unsigned long MAX_LAYOUT_BACKOFF = 60000;
+static const int32_t LAYOUT_CONNECT_TIMEOUT = 250;
+static const unsigned long LAYOUT_TIMEOUT = 2000;
+
+DashboardPeer::DashboardPeer(const char* name, const char* host, uint16_t port, uint16_t wsPort) {
+    this->name = name;
+    this->host = host;
+    this->port = port;
+    this->wsPort = wsPort;
+    started = false;
+    connected = false;
+    layoutPending = false;
+    layoutAttemptAt = 0;
+    layoutBackoff = RECONNECT_INTERVAL;
+    layoutVersion = 0;
+    fetching = false;
+}
+
+void DashboardPeer::loop() {
+    if (!started) {
+        client.begin(host, wsPort, "/");
+        client.setReconnectInterval(RECONNECT_INTERVAL);
+        client.onEvent([this](WStype_t type, uint8_t* payload, size_t length) {
+            onEvent(type, payload, length);
+            });
+        started = true;
+    }
+
+    client.loop();
+}
+
+void DashboardPeer::onEvent(WStype_t type, uint8_t* payload, size_t length) {
+    switch (type) {
+    case WStype_CONNECTED:
+        connected = true;
+        layoutPending = true;
+        layoutAttemptAt = 0;
+        layoutBackoff = RECONNECT_INTERVAL;
+        if (onConnectionChange) onConnectionChange(*this, true);
+        break;
+
+    case WStype_DISCONNECTED:
+        if (!connected) break;
+        connected = false;
+        if (fetching) finishLayoutFetch(false);
+        if (onConnectionChange) onConnectionChange(*this, false);
+        break;
+
+    case WStype_TEXT:
+        if (onMessage) onMessage(*this, payload, length);
+        break;
+
+    default:
+        break;
+    }
+}
+
+bool DashboardPeer::isConnected() const {
+    return connected;
+}
+
+const String& DashboardPeer::getName() const {
+    return name;
+}
+
+void DashboardPeer::requestLayout() {
+    if (!layoutPending) layoutAttemptAt = 0;
+    layoutPending = true;
+}
+
+bool DashboardPeer::isLayoutDue() const {
+    if (!layoutPending || !connected || fetching) return false;
+    return layoutAttemptAt == 0 || millis() - layoutAttemptAt >= layoutBackoff;
+}
+
+bool DashboardPeer::startLayoutFetch() {
+    layoutAttemptAt = millis();
+
+    // Peers are on the local network; one that does not answer quickly is
+    // tried again later rather than stalling the hub's loop()
+    if (!http.connect(host.c_str(), port, LAYOUT_CONNECT_TIMEOUT)) {
+        finishLayoutFetch(false);
+        return false;
+    }
+
+    // HTTP/1.0: no chunked encoding, the peer closes after the body
+    http.print("GET /api/layout HTTP/1.0\r\nHost: " + host + "\r\nConnection: close\r\n\r\n");
+    response = "";
+    fetching = true;
+    return true;
+}
+
+LayoutFetch DashboardPeer::serviceLayout(String& body) {
+    if (!fetching) return LAYOUT_IDLE;
+
+    uint8_t buffer[256];
+    while (http.available() > 0) {
+        int count = http.read(buffer, sizeof(buffer));
+        if (count <= 0) break;
+        response.concat((const char*)buffer, count);
+    }
+
+    if (http.connected() || http.available() > 0) {
+        if (millis() - layoutAttemptAt < LAYOUT_TIMEOUT) return LAYOUT_RUNNING;
+        finishLayoutFetch(false);
+        return LAYOUT_FAILED;
+    }
+
+    // Closed by the peer: status line, headers, body
+    int headerEnd = response.indexOf("\r\n\r\n");
+    bool ok = headerEnd > 0 && response.startsWith("HTTP/1.") && response.substring(9, 12) == "200";
+    if (ok) body = response.substring(headerEnd + 4);
+    finishLayoutFetch(ok);
+    return ok ? LAYOUT_READY : LAYOUT_FAILED;
+}
+
+void DashboardPeer::finishLayoutFetch(bool ok) {
+    http.stop();
+    fetching = false;
+    response = "";
+
+    if (ok) {
+        layoutPending = false;
+        layoutBackoff = RECONNECT_INTERVAL;
+    }
+    else {
+        layoutBackoff = std::min(layoutBackoff * 2, MAX_LAYOUT_BACKOFF);
+    }
+}
+
+unsigned long DashboardPeer::getLayoutVersion() const {
+    return layoutVersion;
+}
+
+void DashboardPeer::setLayoutVersion(unsigned long version) {
+    layoutVersion = version;
+}
+
+bool DashboardPeer::send(const String& message) {
+    if (!connected) return false;
+    String text = message;
+    return client.sendTXT(text);
+}
@@ -0,0 +1,71 @@
+#ifndef DASHBOARDPEER_H
+#define DASHBOARDPEER_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <WebSocketsClient.h>
+#include <functional>
+
+// Progress of a layout fetch, see DashboardPeer::serviceLayout()
+enum LayoutFetch {
+	LAYOUT_IDLE,
+	LAYOUT_RUNNING,
+	LAYOUT_READY,
+	LAYOUT_FAILED
+};
+
+// Connection from a hub dashboard to one peer dashboard.
+// Subscribes to the peer's WebSocket delta stream (the hub is one client
+// there, however many browsers watch the hub) and fetches its layout over
+// HTTP. Pure transport: merging into the hub's widgets is done by the owner.
+class DashboardPeer {
+private:
+	String name;
+	String host;
+	uint16_t port;
+	uint16_t wsPort;
+	WebSocketsClient client;
+	bool started;
+	bool connected;
+	bool layoutPending;
+	unsigned long layoutAttemptAt;
+	unsigned long layoutBackoff;
+	unsigned long layoutVersion;
+
+	// Layout fetch in progress: raw HTTP response read a bit per loop()
+	WiFiClient http;
+	bool fetching;
+	String response;
+
+	void onEvent(WStype_t type, uint8_t* payload, size_t length);
+	void finishLayoutFetch(bool ok);
+
+public:
+	DashboardPeer(const char* name, const char* host, uint16_t port, uint16_t wsPort);
+
+	// Connects on first call and reconnects on its own afterwards
+	void loop();
+	bool isConnected() const;
+	const String& getName() const;
+
+	// Layout is (re)fetched after connecting and whenever the peer reports a
+	// layout version the hub has not mirrored yet; failed fetches are
+	// retried with a backoff from the reconnect interval up to a minute.
+	// startLayoutFetch() only connects (with a short timeout) and sends the
+	// request; serviceLayout() reads whatever has arrived without blocking
+	// and hands over the body once the peer has sent all of it.
+	void requestLayout();
+	bool isLayoutDue() const;
+	bool startLayoutFetch();
+	LayoutFetch serviceLayout(String& body);
+	unsigned long getLayoutVersion() const;
+	void setLayoutVersion(unsigned long version);
+
+	bool send(const String& message);
+
+	// Called from loop() with every text frame the peer sends
+	std::function<void(DashboardPeer&, uint8_t*, size_t)> onMessage;
+	std::function<void(DashboardPeer&, bool)> onConnectionChange;
+};
+
+#endif
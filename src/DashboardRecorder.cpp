@@ -0,0 +1,120 @@
+#include "DashboardRecorder.h"
+
+// Rough per-event overhead on top of the payload (deque slot + String)
+static const size_t EVENT_OVERHEAD = 24;
+
+DashboardRecorder::DashboardRecorder() {
+    bytes = 0;
+    maxBytes = 0;
+    recording = false;
+    includeFrames = false;
+    startedAt = 0;
+    dropped = 0;
+    replaying = false;
+    speed = 1.0;
+    replayIndex = 0;
+    replayStartedAt = 0;
+}
+
+bool DashboardRecorder::start(size_t maxBytes, bool includeFrames) {
+    if (replaying) return false;
+    events.clear();
+    bytes = 0;
+    dropped = 0;
+    this->maxBytes = maxBytes;
+    this->includeFrames = includeFrames;
+    startedAt = millis();
+    recording = true;
+    return true;
+}
+
+void DashboardRecorder::stop() {
+    recording = false;
+}
+
+bool DashboardRecorder::isRecording() const {
+    return recording;
+}
+
+bool DashboardRecorder::recordsFrames() const {
+    return recording && includeFrames;
+}
+
+void DashboardRecorder::record(RecordedEventType type, uint8_t client, const String& payload) {
+    if (!recording) return;
+    if (type == EVENT_FRAME && !includeFrames) return;
+
+    size_t size = payload.length() + EVENT_OVERHEAD;
+    if (size > maxBytes) return;
+
+    while (!events.empty() && bytes + size > maxBytes) {
+        bytes -= events.front().payload.length() + EVENT_OVERHEAD;
+        events.pop_front();
+        dropped++;
+    }
+
+    events.push_back({ (uint32_t)(millis() - startedAt), type, client, payload });
+    bytes += size;
+}
+
+const std::deque<RecordedEvent>& DashboardRecorder::getEvents() const {
+    return events;
+}
+
+uint32_t DashboardRecorder::getDropped() const {
+    return dropped;
+}
+
+size_t DashboardRecorder::getBytes() const {
+    return bytes;
+}
+
+const char* DashboardRecorder::typeName(RecordedEventType type) {
+    switch (type) {
+    case EVENT_CONNECT: return "connect";
+    case EVENT_DISCONNECT: return "disconnect";
+    case EVENT_WS_MESSAGE: return "ws";
+    case EVENT_HTTP_CONTROL: return "http";
+    case EVENT_FRAME: return "frame";
+    }
+    return "";
+}
+
+bool DashboardRecorder::startReplay(float speed) {
+    if (events.empty() || speed <= 0) return false;
+
+    // Replayed traffic must not end up in its own recording
+    recording = false;
+    this->speed = speed;
+    replayIndex = 0;
+    replayStartedAt = millis();
+    replaying = true;
+    return true;
+}
+
+void DashboardRecorder::stopReplay() {
+    replaying = false;
+}
+
+bool DashboardRecorder::isReplaying() const {
+    return replaying;
+}
+
+const RecordedEvent* DashboardRecorder::nextDue() {
+    if (!replaying) return nullptr;
+
+    // Outbound frames are the device's own output; they are regenerated
+    while (replayIndex < events.size() && events[replayIndex].type == EVENT_FRAME) replayIndex++;
+    if (replayIndex >= events.size()) {
+        replaying = false;
+        return nullptr;
+    }
+
+    // Offsets are relative to the first event so a trimmed recording starts at once
+    const RecordedEvent& event = events[replayIndex];
+    uint32_t offset = event.time - events.front().time;
+    if ((millis() - replayStartedAt) * speed < offset) return nullptr;
+
+    replayIndex++;
+    return &event;
+}
@@ -0,0 +1,67 @@
+#ifndef DASHBOARDRECORDER_H
+#define DASHBOARDRECORDER_H
+
+#include <Arduino.h>
+#include <deque>
+
+// Recorded event kinds; client is the WebSocket client number (255 for
+// HTTP requests and broadcast frames)
+enum RecordedEventType {
+	EVENT_CONNECT,
+	EVENT_DISCONNECT,
+	EVENT_WS_MESSAGE,
+	EVENT_HTTP_CONTROL,
+	EVENT_FRAME
+};
+
+struct RecordedEvent {
+	uint32_t time;
+	RecordedEventType type;
+	uint8_t client;
+	String payload;
+};
+
+// Session recorder with a RAM budget. When the budget is exceeded the oldest
+// events are dropped, so the recording always holds the most recent traffic.
+// Also keeps the cursor for replaying a recording at its original pace.
+class DashboardRecorder {
+private:
+	std::deque<RecordedEvent> events;
+	size_t bytes;
+	size_t maxBytes;
+	bool recording;
+	bool includeFrames;
+	unsigned long startedAt;
+	uint32_t dropped;
+
+	bool replaying;
+	float speed;
+	size_t replayIndex;
+	unsigned long replayStartedAt;
+
+public:
+	static const uint8_t NO_CLIENT = 255;
+
+	DashboardRecorder();
+
+	// Fails while replaying: starting clears the events being replayed
+	bool start(size_t maxBytes, bool includeFrames);
+	void stop();
+	bool isRecording() const;
+	bool recordsFrames() const;
+	void record(RecordedEventType type, uint8_t client, const String& payload);
+
+	const std::deque<RecordedEvent>& getEvents() const;
+	uint32_t getDropped() const;
+	size_t getBytes() const;
+	static const char* typeName(RecordedEventType type);
+
+	// Replay: nextDue() hands out the inbound events whose (scaled) time has
+	// come, one per call, and returns nullptr when none is due
+	bool startReplay(float speed);
+	void stopReplay();
+	bool isReplaying() const;
+	const RecordedEvent* nextDue();
+};
+
+#endif
@@ -0,0 +1,173 @@
+#include "DashboardTimerWheel.h"
+
+// Timer indices are int16_t and ids carry a 15-bit generation in the upper
+// bits, so a valid id is never negative however often a slot is reused
+static const int16_t MAX_TIMERS = 0x7FFF;
+static const uint16_t GENERATION_MASK = 0x7FFF;
+static const int16_t NONE = -1;
+static const uint32_t MAX_DELTA = (1UL << 30) - 1;
+
+DashboardTimerWheel::DashboardTimerWheel() {
+    for (int level = 0; level < LEVELS; level++) {
+        for (int slot = 0; slot < SLOTS; slot++) slots[level][slot] = NONE;
+    }
+    current = 0;
+    started = false;
+    count = 0;
+}
+
+int32_t DashboardTimerWheel::schedule(uint32_t now, uint32_t delay, uint32_t period, std::function<void()> callback) {
+    // Past half the 32-bit range the expiry would read as already due
+    if (delay > MAX_DELAY || period > MAX_DELAY) return -1;
+
+    if (!started) {
+        current = now;
+        started = true;
+    }
+
+    int16_t index;
+    if (!freeList.empty()) {
+        index = freeList.back();
+        freeList.pop_back();
+    }
+    else {
+        if (pool.size() >= (size_t)MAX_TIMERS) return -1;
+        pool.push_back(Timer());
+        index = pool.size() - 1;
+        pool[index].generation = 0;
+    }
+
+    Timer& timer = pool[index];
+    timer.expires = now + delay;
+    if ((int32_t)(timer.expires - current) <= 0) timer.expires = current + 1;
+    timer.period = period;
+    timer.callback = std::move(callback);
+    timer.active = true;
+    file(index);
+    count++;
+    return idOf(index);
+}
+
+bool DashboardTimerWheel::cancel(int32_t id) {
+    if (!isScheduled(id)) return false;
+    int16_t index = id & 0xFFFF;
+    unlink(index);
+    expire(index);
+    return true;
+}
+
+bool DashboardTimerWheel::isScheduled(int32_t id) const {
+    if (id < 0) return false;
+    size_t index = id & 0xFFFF;
+    return index < pool.size() && pool[index].active && idOf(index) == id;
+}
+
+void DashboardTimerWheel::advance(uint32_t now) {
+    if (!started) {
+        current = now;
+        started = true;
+        return;
+    }
+
+    // Nothing to fire or cascade, so idle time costs nothing
+    if (count == 0) {
+        current = now;
+        return;
+    }
+
+    while ((int32_t)(now - current) > 0) {
+        current++;
+
+        // Entering a new lap of a level brings the next slot of the level
+        // above down
+        uint32_t time = current;
+        for (int level = 1; level < LEVELS && (time & (SLOTS - 1)) == 0; level++) {
+            time >>= SLOT_BITS;
+            cascade(level);
+        }
+
+        int16_t* slot = &slots[0][current & (SLOTS - 1)];
+        while (*slot != NONE) {
+            int16_t index = *slot;
+            unlink(index);
+            Timer& timer = pool[index];
+
+            // The callback is moved out, not copied, so firing never
+            // allocates; the pool may grow while it runs
+            std::function<void()> callback = std::move(timer.callback);
+            if (timer.period == 0) {
+                expire(index);
+                callback();
+                continue;
+            }
+
+            // Periodic timers are filed again before the callback so it can
+            // cancel them; a long stall skips missed periods
+            int32_t id = idOf(index);
+            timer.expires += timer.period;
+            if ((int32_t)(timer.expires - current) <= 0) timer.expires = current + timer.period;
+            file(index);
+            callback();
+            if (isScheduled(id)) pool[index].callback = std::move(callback);
+        }
+    }
+}
+
+int32_t DashboardTimerWheel::idOf(int16_t index) const {
+    return ((int32_t)pool[index].generation << 16) | index;
+}
+
+size_t DashboardTimerWheel::size() const {
+    return count;
+}
+
+void DashboardTimerWheel::file(int16_t index) {
+    Timer& timer = pool[index];
+
+    // Level by distance, slot by absolute expiry; anything beyond the top
+    // level waits in its last slot and is re-filed when that is cascaded
+    uint32_t delta = timer.expires - current;
+    uint32_t target = delta > MAX_DELTA ? current + MAX_DELTA : timer.expires;
+    if (delta > MAX_DELTA) delta = MAX_DELTA;
+
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (1UL << (SLOT_BITS * (level + 1)))) level++;
+    uint8_t slot = (target >> (SLOT_BITS * level)) & (SLOTS - 1);
+
+    timer.level = level;
+    timer.slot = slot;
+    timer.prev = NONE;
+    timer.next = slots[level][slot];
+    if (timer.next != NONE) pool[timer.next].prev = index;
+    slots[level][slot] = index;
+}
+
+void DashboardTimerWheel::unlink(int16_t index) {
+    Timer& timer = pool[index];
+    if (timer.prev != NONE) pool[timer.prev].next = timer.next;
+    else slots[timer.level][timer.slot] = timer.next;
+    if (timer.next != NONE) pool[timer.next].prev = timer.prev;
+    timer.prev = NONE;
+    timer.next = NONE;
+}
+
+void DashboardTimerWheel::cascade(int level) {
+    uint8_t slot = (current >> (SLOT_BITS * level)) & (SLOTS - 1);
+    int16_t index = slots[level][slot];
+    slots[level][slot] = NONE;
+
+    while (index != NONE) {
+        int16_t next = pool[index].next;
+        file(index);
+        index = next;
+    }
+}
+
+void DashboardTimerWheel::expire(int16_t index) {
+    Timer& timer = pool[index];
+    timer.active = false;
+    timer.callback = nullptr;
+    timer.generation = (timer.generation + 1) & GENERATION_MASK;
+    freeList.push_back(index);
+    count--;
+}
@@ -0,0 +1,63 @@
+#ifndef DASHBOARDTIMERWHEEL_H
+#define DASHBOARDTIMERWHEEL_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+// Hierarchical timer wheel with 1 ms resolution: five levels of 64 slots
+// cover 2^30 ms (12 days) and longer timers are re-filed as they come
+// closer. Scheduling, cancelling and each elapsed millisecond cost O(1);
+// timers move down a level at most once per level. Timers live in a pool
+// linked by index, so a timer that is reused does not allocate.
+class DashboardTimerWheel {
+private:
+	static const int LEVELS = 5;
+	static const int SLOT_BITS = 6;
+	static const int SLOTS = 1 << SLOT_BITS;
+
+	struct Timer {
+		uint32_t expires;
+		uint32_t period;
+		std::function<void()> callback;
+		int16_t prev;
+		int16_t next;
+		int8_t level;
+		uint8_t slot;
+		uint16_t generation;
+		bool active;
+	};
+
+	std::vector<Timer> pool;
+	std::vector<int16_t> freeList;
+	int16_t slots[LEVELS][SLOTS];
+	uint32_t current;
+	bool started;
+	size_t count;
+
+	void file(int16_t index);
+	void unlink(int16_t index);
+	void cascade(int level);
+	void expire(int16_t index);
+	int32_t idOf(int16_t index) const;
+
+public:
+	// Expiry times are compared as signed 32-bit differences
+	static const uint32_t MAX_DELAY = 0x7FFFFFFF;
+
+	DashboardTimerWheel();
+
+	// Runs callback after delay ms (relative to now), then every period ms
+	// if period > 0. Returns an id for cancel(), or -1 if the pool is full
+	// or delay or period exceeds MAX_DELAY (about 24.8 days).
+	int32_t schedule(uint32_t now, uint32_t delay, uint32_t period, std::function<void()> callback);
+	bool cancel(int32_t id);
+	bool isScheduled(int32_t id) const;
+
+	// Fires everything due up to now, in expiry order per millisecond.
+	// Callbacks may schedule and cancel timers.
+	void advance(uint32_t now);
+	size_t size() const;
+};
+
+#endif
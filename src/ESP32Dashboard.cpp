@@ -1,4 +1,12 @@
 #include "ESP32Dashboard.h"
+#include "DashboardAssets.h"
+#include "DashboardCodec.h"
+#include "DashboardCommand.h"
+#include <algorithm>
+#include <cmath>
+
+// Top-level fields of a value frame; cards and controls add their own share
+static const size_t FRAME_CAPACITY = 512;
 
 ESP32Dashboard::ESP32Dashboard() {
     server = nullptr;
@@ -10,11 +18,35 @@ ESP32Dashboard::ESP32Dashboard() {
     updateInterval = 1000;
     serialMonitoring = true;
     serialBaudRate = 115200;
+    lastReportedClients = -1;
+    frameSequence = 0;
+    framesSent = 0;
+    bytesSent = 0;
+    lastMemorySample = 0;
+    memoryWarned = false;
+    nextCardIndex = 0;
+    nextControlIndex = 0;
+    layoutVersion = 0;
+    captureActive = false;
+    captureSharesSensor = false;
+    captureStartedAt = 0;
+    mqtt = nullptr;
+    mqttConnected = false;
+    mqttLastAttempt = 0;
+    modbus = nullptr;
+    nextModbusRegister = 0;
+    nextModbusCoil = 0;
+    nextControlHandle = 0;
+    nextCardHandle = 0;
+    updateDepth = 0;
+    nextModbusHolding = 0;
 }
 
 ESP32Dashboard::~ESP32Dashboard() {
     if (server) delete server;
     if (webSocket) delete webSocket;
+    for (auto peer : peers) delete peer;
+    delete modbus;
 }
 
 void ESP32Dashboard::enableSerialMonitoring(bool enable) {
@@ -71,7 +103,36 @@ void ESP32Dashboard::printSystemStatus() {
     logToSerial("Dashboard Title: " + dashboardTitle, "DASHBOARD");
     logToSerial("Total Cards: " + String(cards.size()), "DASHBOARD");
     logToSerial("Total Controls: " + String(controls.size()), "DASHBOARD");
+    logToSerial("Active Timers: " + String((unsigned long)timers.size()), "DASHBOARD");
     logToSerial("Update Interval: " + String(updateInterval) + "ms", "DASHBOARD");
+    if (!espNowNodes.empty()) {
+        int stale = 0;
+        uint32_t lost = 0;
+        for (auto& node : espNowNodes) {
+            if (node.stale) stale++;
+            lost += node.lost;
+        }
+        logToSerial("ESP-NOW Nodes: " + String(espNowNodes.size()) + " (" + String(stale) + " stale, " +
+            String(lost) + " packets lost, " + String(espNow.getDropped()) + " dropped)", "ESPNOW");
+    }
+    if (modbus) {
+        logToSerial("Modbus TCP: " + String(modbus->getRequests()) + " requests, " + String(modbus->getExceptions()) + " exceptions", "MODBUS");
+    }
+    if (!peers.empty()) {
+        logToSerial("Peers: " + String(getConnectedPeers()) + "/" + String(peers.size()) + " connected", "HUB");
+    }
+
+    logToSerial("Heap: " + String(ESP.getFreeHeap()) + " free, " + String(ESP.getMinFreeHeap()) + " min, " +
+        String(ESP.getMaxAllocHeap()) + " largest block", "MEMORY");
+    for (int i = 0; i < MEMORY_SUBSYSTEM_COUNT; i++) {
+        MemorySubsystem subsystem = (MemorySubsystem)i;
+        logToSerial(String(DashboardMemory::name(subsystem)) + ": " + String((unsigned long)DashboardMemory::getCurrent(subsystem)) +
+            " bytes (peak " + String((unsigned long)DashboardMemory::getPeak(subsystem)) + ")", "MEMORY");
+    }
+    if (memory.isLargestBlockShrinking()) {
+        logToSerial("⚠️ Largest free block shrinking by " + String(-memory.getLargestBlockTrend(), 0) +
+            " bytes/hour - heap is fragmenting", "MEMORY");
+    }
 
     printSeparator();
 }
@@ -136,6 +197,7 @@ void ESP32Dashboard::printWebServerInfo() {
         logToSerial("🌐 Web Dashboard URL: http://" + ip, "SERVER");
         logToSerial("📱 Mobile Access: http://" + ip, "SERVER");
         logToSerial("🔗 API Endpoint: http://" + ip + "/api/data", "SERVER");
+        logToSerial("🧩 Layout Endpoint: http://" + ip + "/api/layout", "SERVER");
         logToSerial("⚡ WebSocket: ws://" + ip + ":81", "SERVER");
     }
     else {
@@ -186,10 +248,25 @@ bool ESP32Dashboard::begin(const char* ssid, const char* password, int port, int
     webSocket = new WebSocketsServer(wsPort);
 
     server->on("/", [this]() { handleRoot(); });
+    server->on("/app.css", [this]() {
+        sendAsset(DASHBOARD_APP_CSS_GZ, DASHBOARD_APP_CSS_GZ_LEN, "text/css", DASHBOARD_APP_CSS_VERSION, true);
+        });
+    server->on("/app.js", [this]() {
+        sendAsset(DASHBOARD_APP_JS_GZ, DASHBOARD_APP_JS_GZ_LEN, "application/javascript", DASHBOARD_APP_JS_VERSION, true);
+        });
+    server->on("/app.debug.js", [this]() {
+        sendAsset(DASHBOARD_APP_DEBUG_JS_GZ, DASHBOARD_APP_DEBUG_JS_GZ_LEN, "application/javascript", DASHBOARD_APP_DEBUG_JS_VERSION, true);
+        });
     server->on("/api/data", [this]() { handleApiData(); });
+    server->on("/api/layout", [this]() { handleApiLayout(); });
     server->on("/api/control", HTTP_POST, [this]() { handleApiControl(); });
+    server->on("/api/recording", [this]() { handleApiRecording(); });
+    server->on("/api/stats", [this]() { handleApiStats(); });
     server->onNotFound([this]() { handleNotFound(); });
 
+    const char* headerKeys[] = { "If-None-Match" };
+    server->collectHeaders(headerKeys, 1);
+
     server->begin();
     webSocket->begin();
     webSocket->onEvent([this](uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
@@ -214,113 +291,351 @@ void ESP32Dashboard::setUpdateInterval(unsigned long interval) {
     updateInterval = interval;
 }
 
+void ESP32Dashboard::enableTimeSync(const char* ntpServer, const char* ntpServer2) {
+    clock.beginSntp(ntpServer, ntpServer2);
+    logToSerial("SNTP time sync started (" + String(ntpServer) + ")", "TIME");
+}
+
+void ESP32Dashboard::setTimeSource(std::function<uint64_t()> source) {
+    clock.setSource(source);
+}
+
+bool ESP32Dashboard::isTimeSynced() {
+    return clock.isSynced();
+}
+
+uint64_t ESP32Dashboard::getTimestamp() {
+    return clock.now();
+}
+
 void ESP32Dashboard::loop() {
     server->handleClient();
     webSocket->loop();
+    servicePeers();
+    serviceEspNow();
+    serviceMqtt();
+    if (modbus) modbus->loop();
+    serviceReplay();
+    serviceControls();
+    serviceRules();
+    serviceMemory();
+
+    timers.advance(millis());
+    serviceCapture();
 
     if (millis() - lastUpdate >= updateInterval) {
-        // Update chart data for all chart cards
-        for (auto& card : cards) {
-            if (card.type == CARD_CHART && card.valueCallback) {
-                float value = card.valueCallback().toFloat();
-                addChartDataPoint(card.id.c_str(), value);
-            }
-        }
-
+        sampleCards();
+        // Rule actions go out in the same frame as the values that caused them
+        serviceRules();
         sendDataToClients();
         lastUpdate = millis();
     }
 }
 
-void ESP32Dashboard::addChartDataPoint(const char* cardId, float value) {
+void ESP32Dashboard::sampleCards() {
+    // Each callback runs once per update; the results are cached on the card
+    // and everything that reports values reads the cache.
     for (auto& card : cards) {
-        if (card.id == cardId && card.type == CARD_CHART) {
-            ChartDataPoint point;
-            point.timestamp = millis();
-            point.value = value;
+        // Mirrored cards are refreshed by their peer's frames
+        if (card.peer.length() > 0) continue;
+
+        // Typed updateCard() calls only store the number; it is formatted
+        // here, once per update, however often it was set. A chart that is
+        // also sampled below takes its one point for this update from the sample.
+        bool sampledChart = card.type == CARD_CHART && !card.computeCallback && !isSensorCapturing(card) &&
+            (card.filter.hasValue() || (card.numericCallback && card.sampleInterval == 0));
+        if (card.formatPending) formatCardValue(card, !sampledChart);
+
+        // Inputs come before their computed cards, so by now this update's
+        // input changes have all been seen
+        if (card.computeCallback) {
+            if (card.computePending) computeCard(card);
+            continue;
+        }
+
+        // Holds its last value until a burst on its own sensor is done
+        if (isSensorCapturing(card)) continue;
+
+        if (card.type == CARD_MULTI_CHART) {
+            sampleMultiChart(card);
+            card.dirty = true;
+        }
+        else if (card.numericCallback || card.filter.hasValue()) {
+            if (card.numericCallback && card.sampleInterval == 0) {
+                card.filter.addSample(card.numericCallback());
+            }
+            if (!card.filter.hasValue()) continue;
+
+            setCardNumber(card, card.filter.value());
+            card.value = card.valueFormatter ? card.valueFormatter(card.numericValue) : String(card.numericValue, 2);
+            if (card.statusFormatter) {
+                card.status = card.statusFormatter(card.numericValue);
+            }
+
+            if (card.type == CARD_CHART) {
+                addChartDataPoint(card, card.numericValue);
+            }
+            card.dirty = true;
+        }
+        else if (card.valueCallback || card.statusCallback) {
+            if (card.valueCallback) card.value = card.valueCallback();
+            if (card.statusCallback) card.status = card.statusCallback();
+            card.dirty = true;
+        }
+    }
+}
 
-            card.chartData.push_back(point);
+bool ESP32Dashboard::isSensorCapturing(const DashboardCard& card) {
+    return captureActive && captureSharesSensor && card.id == captureCardId;
+}
 
-            // Keep only maxDataPoints
-            if (card.chartData.size() > card.maxDataPoints) {
-                card.chartData.erase(card.chartData.begin());
+void ESP32Dashboard::setChartCompression(const char* chartId, ChartCompression mode, int precision) {
+    for (auto& card : cards) {
+        if (card.id == chartId && (card.type == CARD_CHART || card.type == CARD_MULTI_CHART)) {
+            uint8_t columns = card.type == CARD_CHART ? 1 : card.chartSeries.size();
+            card.compressedChart.configure(mode, columns, precision);
+
+            // History restarts in the new representation
+            card.chartData.clear();
+            card.chartData.shrink_to_fit();
+            card.chartTimestamps.clear();
+            card.chartTimestamps.shrink_to_fit();
+            for (auto& series : card.chartSeries) {
+                series.values.clear();
+                series.values.shrink_to_fit();
             }
             break;
         }
     }
 }
 
+bool ESP32Dashboard::startCapture(const char* chartId, uint32_t sampleRate, uint32_t samples, std::function<float()> sampler) {
+    if (captureActive) {
+        logToSerial("Capture already running for '" + captureCardId + "'", "CAPTURE");
+        return false;
+    }
+
+    for (auto& card : cards) {
+        if (card.id == chartId && card.type == CARD_CHART) {
+            // Without its own sampler the burst calls the card's sensor from
+            // the timer task; the card is not sampled in loop() meanwhile
+            bool sharesSensor = !sampler;
+            if (!sampler) sampler = card.numericCallback;
+
+            // The block has to fit in one piece, and sending it needs about
+            // as much again for the encoded copies
+            size_t blockBytes = samples * sizeof(float);
+            if (samples > DashboardCapture::MAX_SAMPLES || blockBytes > ESP.getMaxAllocHeap() || blockBytes * 4 > ESP.getFreeHeap()) {
+                logToSerial("Capture of " + String(samples) + " samples for '" + card.id + "' does not fit in memory", "CAPTURE");
+                return false;
+            }
+
+            captureBlock.clear();
+            captureBlock.reserve(samples);
+            captureStartedAt = clock.now();
+            if (!capture.start(sampler, sampleRate, samples)) {
+                logToSerial("Failed to start capture for '" + card.id + "'", "CAPTURE");
+                return false;
+            }
+
+            captureActive = true;
+            captureCardId = card.id;
+            captureSharesSensor = sharesSensor;
+            logToSerial("Capturing " + String(samples) + " samples @ " + String(sampleRate) + " Hz for '" + card.id + "'", "CAPTURE");
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ESP32Dashboard::isCapturing() {
+    return captureActive;
+}
+
+void ESP32Dashboard::serviceCapture() {
+    if (!captureActive) return;
+
+    capture.drain(captureBlock);
+    if (!capture.isFinished()) return;
+
+    publishCapture();
+    captureActive = false;
+    captureBlock.clear();
+    captureBlock.shrink_to_fit();
+}
+
+void ESP32Dashboard::publishCapture() {
+    if (captureBlock.empty()) return;
+
+    // Failed reads (NaN, inf) are sent as gaps and left out of the range
+    float low = INFINITY;
+    float high = -INFINITY;
+    for (float value : captureBlock) {
+        if (!std::isfinite(value)) continue;
+        low = std::min(low, value);
+        high = std::max(high, value);
+    }
+    if (low > high) low = high = 0;
+
+    // 16-bit quantization over the captured range; consecutive samples are
+    // close, so the zigzag deltas mostly fit in one or two bytes
+    float scale = (high - low) / 65535;
+    if (scale <= 0) scale = 1;
+
+    std::vector<uint8_t> bytes;
+    bytes.reserve(captureBlock.size() * 2);
+    DashboardCodec::appendQuantizedDeltas(bytes, captureBlock.data(), captureBlock.size(), low, scale);
+    String data = DashboardCodec::base64Encode(bytes.data(), bytes.size());
+
+    DashboardJsonDocument doc(data.length() + 384);
+    JsonObject block = doc.createNestedObject("capture");
+    block["id"] = captureCardId;
+    block["rate"] = capture.getSampleRate();
+    block["t0"] = captureStartedAt;
+    block["count"] = captureBlock.size();
+    block["dropped"] = capture.getDropped();
+    block["offset"] = low;
+    block["scale"] = scale;
+    block["data"] = data;
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    webSocket->broadcastTXT(jsonString);
+
+    logToSerial("Capture for '" + captureCardId + "' sent: " + String(captureBlock.size()) + " samples in " + String(bytes.size()) + " bytes", "CAPTURE");
+}
+
+void ESP32Dashboard::sampleMultiChart(DashboardCard& card) {
+    if (card.chartSeries.empty()) return;
+
+    uint64_t now = clock.now();
+    bool compressed = card.compressedChart.getMode() != CHART_COMPRESSION_NONE;
+    std::vector<float> row;
+    row.reserve(card.chartSeries.size());
+
+    String summary = "";
+    for (auto& series : card.chartSeries) {
+        float value = series.callback ? series.callback() : 0;
+        row.push_back(value);
+        if (!compressed) series.values.push_back(value);
+
+        if (summary.length() > 0) summary += " · ";
+        summary += series.label + " " + String(value, 2);
+    }
+    card.value = summary;
+
+    if (compressed) {
+        card.compressedChart.append(now, row.data());
+        if (card.compressedChart.size() > card.maxDataPoints) {
+            card.compressedChart.dropOldest();
+        }
+        return;
+    }
+
+    card.chartTimestamps.push_back(now);
+
+    // All columns are trimmed together so rows stay aligned
+    if (card.chartTimestamps.size() > card.maxDataPoints) {
+        card.chartTimestamps.erase(card.chartTimestamps.begin());
+        for (auto& series : card.chartSeries) {
+            series.values.erase(series.values.begin());
+        }
+    }
+}
+
+void ESP32Dashboard::addChartDataPoint(DashboardCard& card, float value) {
+    if (card.compressedChart.getMode() != CHART_COMPRESSION_NONE) {
+        card.compressedChart.append(clock.now(), &value);
+        if (card.compressedChart.size() > card.maxDataPoints) {
+            card.compressedChart.dropOldest();
+        }
+        return;
+    }
+
+    ChartDataPoint point;
+    point.timestamp = clock.now();
+    point.value = value;
+
+    card.chartData.push_back(point);
+
+    // Keep only maxDataPoints
+    if (card.chartData.size() > card.maxDataPoints) {
+        card.chartData.erase(card.chartData.begin());
+    }
+}
+
 String ESP32Dashboard::addTemperatureCard(const char* title, std::function<float()> callback) {
     DashboardCard card;
-    card.id = "temp_" + String(cards.size());
+    card.id = "temp_" + String(nextCardIndex++);
     card.title = title;
     card.description = "Temperature";
     card.color = "orange";
     card.icon = "🌡️";
     card.type = CARD_TEMPERATURE;
-    card.valueCallback = [callback]() -> String {
-        float temp = callback();
+    card.numericCallback = callback;
+    card.valueFormatter = [](float temp) -> String {
         return String(temp, 1) + "°C";
         };
-    card.statusCallback = [callback]() -> String {
-        float temp = callback();
+    card.statusFormatter = [](float temp) -> String {
         if (temp > 30) return "🔥 High temperature";
         if (temp < 15) return "❄️ Low temperature";
         return "✅ Normal range";
         };
 
-    cards.push_back(card);
-    return card.id;
+    return registerCard(card);
 }
 
 String ESP32Dashboard::addHumidityCard(const char* title, std::function<float()> callback) {
     DashboardCard card;
-    card.id = "hum_" + String(cards.size());
+    card.id = "hum_" + String(nextCardIndex++);
     card.title = title;
     card.description = "Humidity";
     card.color = "blue";
     card.icon = "💧";
     card.type = CARD_HUMIDITY;
-    card.valueCallback = [callback]() -> String {
-        float hum = callback();
+    card.numericCallback = callback;
+    card.valueFormatter = [](float hum) -> String {
         return String(hum, 1) + "%";
         };
-    card.statusCallback = [callback]() -> String {
-        float hum = callback();
+    card.statusFormatter = [](float hum) -> String {
         if (hum > 70) return "💧 High humidity";
         if (hum < 30) return "🏜️ Low humidity";
         return "✅ Optimal";
         };
 
-    cards.push_back(card);
-    return card.id;
+    return registerCard(card);
 }
 
 String ESP32Dashboard::addMotorRPMCard(const char* title, std::function<int()> callback) {
     DashboardCard card;
-    card.id = "rpm_" + String(cards.size());
+    card.id = "rpm_" + String(nextCardIndex++);
     card.title = title;
     card.description = "Motor RPM";
     card.color = "green";
     card.icon = "⚙️";
     card.type = CARD_MOTOR_RPM;
-    card.valueCallback = [callback]() -> String {
-        return String(callback());
+    // No callback: the card is fed with addCardSample()
+    if (callback) {
+        card.numericCallback = [callback]() -> float {
+            return callback();
+            };
+    }
+    card.valueFormatter = [](float rpm) -> String {
+        return String((int)rpm);
         };
-    card.statusCallback = [callback]() -> String {
-        int rpm = callback();
+    card.statusFormatter = [](float value) -> String {
+        int rpm = value;
         if (rpm > 1400) return "⚡ High speed";
         if (rpm < 800) return "🐌 Low speed";
         return "✅ Normal speed";
         };
 
-    cards.push_back(card);
-    return card.id;
+    return registerCard(card);
 }
 
 String ESP32Dashboard::addStatusCard(const char* title, const char* description, std::function<String()> valueCallback, std::function<String()> statusCallback, const char* color) {
     DashboardCard card;
-    card.id = "status_" + String(cards.size());
+    card.id = "status_" + String(nextCardIndex++);
     card.title = title;
     card.description = description;
     card.color = color;
@@ -329,36 +644,40 @@ String ESP32Dashboard::addStatusCard(const char* title, const char* description,
     card.valueCallback = valueCallback;
     card.statusCallback = statusCallback;
 
-    cards.push_back(card);
-    return card.id;
+    return registerCard(card);
 }
 
 String ESP32Dashboard::addPercentageCard(const char* title, const char* description, std::function<int()> callback, const char* color) {
     DashboardCard card;
-    card.id = "pct_" + String(cards.size());
+    card.id = "pct_" + String(nextCardIndex++);
     card.title = title;
     card.description = description;
     card.color = color;
     card.icon = "📊";
     card.type = CARD_PERCENTAGE;
-    card.valueCallback = [callback]() -> String {
-        return String(callback()) + "%";
+    // No callback: the card is fed with addCardSample()
+    if (callback) {
+        card.numericCallback = [callback]() -> float {
+            return callback();
+            };
+    }
+    card.valueFormatter = [](float pct) -> String {
+        return String((int)pct) + "%";
         };
-    card.statusCallback = [callback]() -> String {
-        int pct = callback();
+    card.statusFormatter = [](float value) -> String {
+        int pct = value;
         if (pct > 80) return "🔋 Excellent";
         if (pct > 50) return "✅ Good";
         if (pct > 20) return "⚠️ Low";
         return "🔴 Critical";
         };
 
-    cards.push_back(card);
-    return card.id;
+    return registerCard(card);
 }
 
 String ESP32Dashboard::addCustomCard(const char* title, const char* description, std::function<String()> valueCallback, std::function<String()> statusCallback, const char* color, const char* icon) {
     DashboardCard card;
-    card.id = "custom_" + String(cards.size());
+    card.id = "custom_" + String(nextCardIndex++);
     card.title = title;
     card.description = description;
     card.color = color;
@@ -367,33 +686,71 @@ String ESP32Dashboard::addCustomCard(const char* title, const char* description,
     card.valueCallback = valueCallback;
     card.statusCallback = statusCallback;
 
-    cards.push_back(card);
-    return card.id;
+    return registerCard(card);
 }
 
 String ESP32Dashboard::addChartCard(const char* title, const char* description, std::function<float()> callback, const char* color, int maxPoints) {
     DashboardCard card;
-    card.id = "chart_" + String(cards.size());
+    card.id = "chart_" + String(nextCardIndex++);
     card.title = title;
     card.description = description;
     card.color = color;
     card.icon = "📈";
     card.type = CARD_CHART;
     card.maxDataPoints = maxPoints;
-    card.valueCallback = [callback]() -> String {
-        return String(callback(), 2);
+    card.numericCallback = callback;
+    card.valueFormatter = [](float value) -> String {
+        return String(value, 2);
         };
-    card.statusCallback = []() -> String {
+    card.statusFormatter = [](float value) -> String {
         return "Real-time data";
         };
 
-    cards.push_back(card);
-    return card.id;
+    return registerCard(card);
+}
+
+String ESP32Dashboard::addMultiChartCard(const char* title, const char* description, int maxPoints) {
+    DashboardCard card;
+    card.id = "mchart_" + String(nextCardIndex++);
+    card.title = title;
+    card.description = description;
+    card.color = "blue";
+    card.icon = "📈";
+    card.type = CARD_MULTI_CHART;
+    card.maxDataPoints = maxPoints;
+    card.status = "Real-time data";
+
+    return registerCard(card);
+}
+
+bool ESP32Dashboard::addChartSeries(const char* chartId, const char* label, std::function<float()> callback, const char* color) {
+    for (auto& card : cards) {
+        if (card.id == chartId && card.type == CARD_MULTI_CHART) {
+            ChartSeries series;
+            series.label = label;
+            series.color = color;
+            series.callback = callback;
+            card.chartSeries.push_back(series);
+
+            // Rows recorded before this series existed start out empty
+            card.chartTimestamps.clear();
+            for (auto& existing : card.chartSeries) {
+                existing.values.clear();
+            }
+            if (card.compressedChart.getMode() != CHART_COMPRESSION_NONE) {
+                card.compressedChart.configure(card.compressedChart.getMode(), card.chartSeries.size(), card.compressedChart.getPrecision());
+            }
+
+            publishLayoutChange("add", "card", &card, nullptr);
+            return true;
+        }
+    }
+    return false;
 }
 
 String ESP32Dashboard::addSwitch(const char* title, const char* description, std::function<void(bool)> callback, const char* color) {
     DashboardControl control;
-    control.id = "switch_" + String(controls.size());
+    control.id = "switch_" + String(nextControlIndex++);
     control.title = title;
     control.description = description;
     control.type = CONTROL_SWITCH;
@@ -401,13 +758,12 @@ String ESP32Dashboard::addSwitch(const char* title, const char* description, std
     control.color = color;
     control.switchCallback = callback;
 
-    controls.push_back(control);
-    return control.id;
+    return registerControl(control);
 }
 
 String ESP32Dashboard::addButton(const char* title, const char* description, std::function<void()> callback, const char* color) {
     DashboardControl control;
-    control.id = "btn_" + String(controls.size());
+    control.id = "btn_" + String(nextControlIndex++);
     control.title = title;
     control.description = description;
     control.type = CONTROL_BUTTON;
@@ -415,13 +771,12 @@ String ESP32Dashboard::addButton(const char* title, const char* description, std
     control.color = color;
     control.buttonCallback = callback;
 
-    controls.push_back(control);
-    return control.id;
+    return registerControl(control);
 }
 
 String ESP32Dashboard::addPowerButton(const char* title, const char* description, std::function<void(bool)> callback) {
     DashboardControl control;
-    control.id = "power_" + String(controls.size());
+    control.id = "power_" + String(nextControlIndex++);
     control.title = title;
     control.description = description;
     control.type = CONTROL_POWER_BUTTON;
@@ -429,13 +784,12 @@ String ESP32Dashboard::addPowerButton(const char* title, const char* description
     control.color = "green";
     control.switchCallback = callback;
 
-    controls.push_back(control);
-    return control.id;
+    return registerControl(control);
 }
 
 String ESP32Dashboard::addSlider(const char* title, const char* description, std::function<void(int)> callback, int min, int max, const char* color) {
     DashboardControl control;
-    control.id = "slider_" + String(controls.size());
+    control.id = "slider_" + String(nextControlIndex++);
     control.title = title;
     control.description = description;
     control.type = CONTROL_SLIDER;
@@ -445,1386 +799,1952 @@ String ESP32Dashboard::addSlider(const char* title, const char* description, std
     control.color = color;
     control.sliderCallback = callback;
 
-    controls.push_back(control);
-    return control.id;
+    return registerControl(control);
 }
 
-bool ESP32Dashboard::getSwitchState(const char* id) {
-    for (auto& control : controls) {
-        if (control.id == id && (control.type == CONTROL_SWITCH || control.type == CONTROL_POWER_BUTTON)) {
-            return control.state;
-        }
-    }
-    return false;
+String ESP32Dashboard::addJoystick(const char* title, const char* description, std::function<void(float, float)> callback, const char* color, int rate) {
+    DashboardControl control;
+    control.id = "joystick_" + String(nextControlIndex++);
+    control.title = title;
+    control.description = description;
+    control.type = CONTROL_JOYSTICK;
+    control.color = color;
+    control.rate = constrain(rate, 1, 100);
+    control.joystickCallback = callback;
+
+    return registerControl(control);
 }
 
-void ESP32Dashboard::setSwitchState(const char* id, bool state) {
-    for (auto& control : controls) {
-        if (control.id == id && (control.type == CONTROL_SWITCH || control.type == CONTROL_POWER_BUTTON)) {
-            control.state = state;
-            if (control.switchCallback) {
-                control.switchCallback(state);
-            }
-            break;
+String ESP32Dashboard::addSetpoint(const char* title, const char* description, std::function<void(float)> callback, float initial, float min, float max, float step, const char* color, unsigned long debounce) {
+    DashboardControl control;
+    control.id = "setpoint_" + String(nextControlIndex++);
+    control.title = title;
+    control.description = description;
+    control.type = CONTROL_SETPOINT;
+    control.color = color;
+    control.setpointMin = std::min(min, max);
+    control.setpointMax = std::max(min, max);
+    control.step = step > 0 ? step : 0;
+    control.debounce = debounce;
+    control.setpointCallback = callback;
+
+    // The initial value is the committed one; the callback is not called for it
+    if (!validateSetpoint(control, initial, control.setpoint)) control.setpoint = control.setpointMin;
+    control.committedSetpoint = control.setpoint;
+
+    return registerControl(control);
+}
+
+String ESP32Dashboard::addComputedCard(const char* title, const char* description, std::initializer_list<const char*> inputs, std::function<float(const std::vector<float>&)> compute, std::function<String(float)> formatter, const char* color, const char* icon) {
+    DashboardCard card;
+    for (const char* input : inputs) {
+        CardHandle handle = getCardHandle(input);
+        if (handle.handle == 0xFFFF) {
+            logToSerial("Computed card '" + String(title) + "': unknown input '" + String(input) + "'", "ERROR");
+            return "";
         }
+        card.inputs.push_back(handle);
     }
+
+    card.id = "computed_" + String(nextCardIndex++);
+    card.title = title;
+    card.description = description;
+    card.color = color;
+    card.icon = icon;
+    card.type = CARD_CUSTOM;
+    card.valueKind = CARD_VALUE_FLOAT;
+    card.valueFormatter = formatter;
+    card.computeCallback = compute;
+    String id = registerCard(card);
+
+    // Reverse edges: an input that changes marks this card for recomputation
+    CardHandle self = getCardHandle(id.c_str());
+    for (auto& input : cards.back().inputs) {
+        DashboardCard* source = findCard(input);
+        source->dependents.push_back(self);
+        if (source->revision > 0) cards.back().computePending = true;
+    }
+    return id;
 }
 
-int ESP32Dashboard::getSliderValue(const char* id) {
-    for (auto& control : controls) {
-        if (control.id == id && control.type == CONTROL_SLIDER) {
-            return control.value;
-        }
+String ESP32Dashboard::registerCard(DashboardCard& card) {
+    card.handle = nextCardHandle++;
+    if (card.type != CARD_MULTI_CHART) {
+        card.modbusRegister = nextModbusRegister;
+        nextModbusRegister += 2;
     }
-    return 0;
+    cards.push_back(card);
+    publishLayoutChange("add", "card", &cards.back(), nullptr);
+    return card.id;
 }
 
-void ESP32Dashboard::setSliderValue(const char* id, int value) {
-    for (auto& control : controls) {
-        if (control.id == id && control.type == CONTROL_SLIDER) {
-            control.value = value;
-            if (control.sliderCallback) {
-                control.sliderCallback(value);
+String ESP32Dashboard::registerControl(DashboardControl& control) {
+    control.handle = nextControlHandle++;
+    // Joysticks stream positions and setpoints are floats; neither maps
+    // onto a single coil or register
+    if (control.type == CONTROL_SLIDER) control.modbusAddress = nextModbusHolding++;
+    else if (control.type != CONTROL_JOYSTICK && control.type != CONTROL_SETPOINT) control.modbusAddress = nextModbusCoil++;
+    controls.push_back(control);
+    publishLayoutChange("add", "control", nullptr, &controls.back());
+    return control.id;
+}
+
+bool ESP32Dashboard::removeCard(const char* id) {
+    for (auto it = cards.begin(); it != cards.end(); ++it) {
+        if (it->id == id) {
+            // Computed cards reading this one notice the missing input
+            for (auto& dependent : it->dependents) {
+                DashboardCard* card = findCard(dependent);
+                if (card) card->computePending = true;
             }
-            break;
+            timers.cancel(it->sampleTimer);
+            publishLayoutChange("remove", "card", &*it, nullptr);
+            cards.erase(it);
+            return true;
         }
     }
+    return false;
 }
 
-void ESP32Dashboard::updateCard(const char* id, const char* value, const char* status) {
-    for (auto& card : cards) {
-        if (card.id == id) {
-            card.value = value;
-            if (strlen(status) > 0) {
-                card.status = status;
-            }
-            break;
+bool ESP32Dashboard::removeControl(const char* id) {
+    for (auto it = controls.begin(); it != controls.end(); ++it) {
+        if (it->id == id) {
+            for (int32_t schedule : it->schedules) timers.cancel(schedule);
+            publishLayoutChange("remove", "control", nullptr, &*it);
+            controls.erase(it);
+            return true;
         }
     }
+    return false;
 }
 
-String ESP32Dashboard::getLocalIP() {
-    return WiFi.localIP().toString();
+void ESP32Dashboard::publishLayoutChange(const char* op, const char* kind, const DashboardCard* card, const DashboardControl* control) {
+    layoutVersion++;
+
+    // Before begin() no page has been served yet, so there is nobody to patch
+    if (!webSocket) return;
+
+    DashboardJsonDocument doc(768);
+    JsonObject change = doc.createNestedObject("layout");
+    change["op"] = op;
+    change["kind"] = kind;
+    change["version"] = layoutVersion;
+
+    String id = card ? card->id : control->id;
+    change["id"] = id;
+    if (strcmp(op, "add") == 0) {
+        if (card) serializeCardLayout(change.createNestedObject("widget"), *card);
+        if (control) serializeControlLayout(change.createNestedObject("widget"), *control);
+    }
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    webSocket->broadcastTXT(jsonString);
+
+    logToSerial("Layout " + String(op) + " " + String(kind) + " '" + id + "' (v" + String(layoutVersion) + ")", "LAYOUT");
 }
 
-bool ESP32Dashboard::isConnected() {
-    return WiFi.status() == WL_CONNECTED;
+bool ESP32Dashboard::addPeer(const char* name, const char* host, uint16_t port, uint16_t wsPort) {
+    if (findPeer(name)) return false;
+
+    DashboardPeer* peer = new DashboardPeer(name, host, port, wsPort);
+    peer->onMessage = [this](DashboardPeer& peer, uint8_t* payload, size_t length) {
+        handlePeerMessage(peer, payload, length);
+        };
+    peer->onConnectionChange = [this](DashboardPeer& peer, bool connected) {
+        handlePeerConnection(peer, connected);
+        };
+    peers.push_back(peer);
+
+    logToSerial("Peer '" + String(name) + "' added (" + String(host) + ":" + String(port) + ")", "HUB");
+    return true;
 }
 
-int ESP32Dashboard::getConnectedClients() {
-    return webSocket->connectedClients();
+bool ESP32Dashboard::removePeer(const char* name) {
+    for (auto it = peers.begin(); it != peers.end(); ++it) {
+        if ((*it)->getName() == name) {
+            removePeerWidgets(name, JsonObject());
+            delete *it;
+            peers.erase(it);
+            return true;
+        }
+    }
+    return false;
 }
 
-void ESP32Dashboard::handleRoot() {
-    String html = generateHTML();
-    server->send(200, "text/html", html);
+int ESP32Dashboard::getConnectedPeers() {
+    int count = 0;
+    for (auto peer : peers) {
+        if (peer->isConnected()) count++;
+    }
+    return count;
 }
 
-void ESP32Dashboard::handleApiData() {
-    DynamicJsonDocument doc(4096);
+DashboardPeer* ESP32Dashboard::findPeer(const String& name) {
+    for (auto peer : peers) {
+        if (peer->getName() == name) return peer;
+    }
+    return nullptr;
+}
 
-    JsonArray cardArray = doc.createNestedArray("cards");
-    for (auto& card : cards) {
-        JsonObject cardObj = cardArray.createNestedObject();
-        cardObj["id"] = card.id;
-        cardObj["title"] = card.title;
-        cardObj["description"] = card.description;
-        cardObj["value"] = card.valueCallback ? card.valueCallback() : card.value;
-        cardObj["status"] = card.statusCallback ? card.statusCallback() : card.status;
-        cardObj["color"] = card.color;
-        cardObj["icon"] = card.icon;
-        cardObj["type"] = card.type;
-
-        if (card.type == CARD_CHART) {
-            JsonArray chartArray = cardObj.createNestedArray("chartData");
-            for (auto& point : card.chartData) {
-                JsonObject pointObj = chartArray.createNestedObject();
-                pointObj["timestamp"] = point.timestamp;
-                pointObj["value"] = point.value;
+void ESP32Dashboard::servicePeers() {
+    // At most one new layout connection per loop(); responses are read as
+    // they arrive, so a slow or unreachable peer does not stall the hub
+    bool connecting = false;
+    for (auto peer : peers) {
+        peer->loop();
+        if (!connecting && peer->isLayoutDue()) {
+            connecting = true;
+            if (!peer->startLayoutFetch()) {
+                logToSerial("Layout fetch from peer '" + peer->getName() + "' failed", "HUB");
+                continue;
             }
         }
-    }
 
-    JsonArray controlArray = doc.createNestedArray("controls");
-    for (auto& control : controls) {
-        JsonObject controlObj = controlArray.createNestedObject();
-        controlObj["id"] = control.id;
-        controlObj["title"] = control.title;
-        controlObj["description"] = control.description;
-        controlObj["type"] = control.type;
-        controlObj["state"] = control.state;
-        controlObj["value"] = control.value;
-        controlObj["color"] = control.color;
+        String body;
+        LayoutFetch result = peer->serviceLayout(body);
+        if (result == LAYOUT_FAILED) {
+            logToSerial("Layout fetch from peer '" + peer->getName() + "' failed", "HUB");
+        }
+        if (result != LAYOUT_READY) continue;
+
+        DashboardJsonDocument layout(1024 + body.length() * 2);
+        if (deserializeJson(layout, body)) {
+            logToSerial("Invalid layout from peer '" + peer->getName() + "'", "HUB");
+            continue;
+        }
+        syncPeerLayout(*peer, layout.as<JsonObject>());
     }
+}
 
-    doc["timestamp"] = millis();
-    doc["connectedClients"] = webSocket->connectedClients();
+void ESP32Dashboard::handlePeerConnection(DashboardPeer& peer, bool connected) {
+    logToSerial("Peer '" + peer.getName() + "' " + (connected ? "connected" : "disconnected"), "HUB");
 
-    String jsonString;
-    serializeJson(doc, jsonString);
-    server->send(200, "application/json", jsonString);
+    // Keep the last values on screen but make clear they are no longer live
+    for (auto& card : cards) {
+        if (card.peer != peer.getName()) continue;
+        setCardStale(card.id, connected ? "" : "⚠️ " + peer.getName() + " offline");
+    }
 }
 
-void ESP32Dashboard::handleApiControl() {
-    if (server->hasArg("plain")) {
-        DynamicJsonDocument doc(1024);
-        deserializeJson(doc, server->arg("plain"));
+void ESP32Dashboard::handlePeerMessage(DashboardPeer& peer, uint8_t* payload, size_t length) {
+    // Chart histories are mostly short numbers, which take a few times their
+    // text size once parsed; strings stay in the payload (zero-copy)
+    DashboardJsonDocument doc(512 + length * 3);
+    if (deserializeJson(doc, (char*)payload, length)) return;
 
-        String controlId = doc["id"];
-        String action = doc["action"];
+    String prefix = peer.getName() + ".";
 
-        for (auto& control : controls) {
-            if (control.id == controlId) {
-                if (action == "toggle" && (control.type == CONTROL_SWITCH || control.type == CONTROL_POWER_BUTTON)) {
-                    control.state = !control.state;
-                    if (control.switchCallback) {
-                        control.switchCallback(control.state);
-                    }
-                }
-                else if (action == "click" && control.type == CONTROL_BUTTON) {
-                    if (control.buttonCallback) {
-                        control.buttonCallback();
-                    }
-                }
-                else if (action == "slide" && control.type == CONTROL_SLIDER) {
-                    control.value = doc["value"];
-                    if (control.sliderCallback) {
-                        control.sliderCallback(control.value);
-                    }
-                }
-                break;
-            }
-        }
+    if (doc.containsKey("layout")) {
+        peer.requestLayout();
+        return;
+    }
 
-        server->send(200, "application/json", "{\"status\":\"success\"}");
-        sendDataToClients();
+    // Bursts are one-off blocks; pass them on under the hub's id
+    if (doc.containsKey("capture")) {
+        JsonObject block = doc["capture"];
+        block["id"] = prefix + block["id"].as<String>();
+        String jsonString;
+        serializeJson(doc, jsonString);
+        if (webSocket) webSocket->broadcastTXT(jsonString);
+        return;
     }
-    else {
-        server->send(400, "application/json", "{\"error\":\"No data received\"}");
+
+    if (doc.containsKey("layoutVersion") && doc["layoutVersion"].as<unsigned long>() != peer.getLayoutVersion()) {
+        peer.requestLayout();
     }
-}
 
-void ESP32Dashboard::handleNotFound() {
-    server->send(404, "text/plain", "File Not Found");
-}
+    // Peers send only what changed, so everything here is relayed on the
+    // next update through the usual change reporting
+    for (JsonVariant item : doc["cards"].as<JsonArray>()) {
+        JsonObject update = item.as<JsonObject>();
+        String id = prefix + update["id"].as<String>();
+        for (auto& card : cards) {
+            if (card.id != id) continue;
 
-void ESP32Dashboard::webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
-    switch (type) {
-    case WStype_DISCONNECTED:
-        logToSerial("Client #" + String(num) + " disconnected", "WEBSOCKET");
-        if (onClientDisconnect) onClientDisconnect();
-        break;
+            card.value = update["value"].as<String>();
+            card.status = update["status"].as<String>();
 
-    case WStype_CONNECTED:
-        logToSerial("Client #" + String(num) + " connected from " + webSocket->remoteIP(num).toString(), "WEBSOCKET");
-        if (onClientConnect) onClientConnect();
-        sendDataToClients();
-        break;
-
-    case WStype_TEXT:
-        logToSerial("Message from client #" + String(num) + ": " + String((char*)payload), "WEBSOCKET");
-
-        DynamicJsonDocument doc(512);
-        deserializeJson(doc, (char*)payload);
-
-        if (doc.containsKey("id") && doc.containsKey("action")) {
-            String controlId = doc["id"];
-            String action = doc["action"];
+            update.remove("id");
+            update.remove("value");
+            update.remove("status");
+            update.remove("type");
+            card.mirrorData = "";
+            if (update.size() > 0) serializeJson(update, card.mirrorData);
 
-            for (auto& control : controls) {
-                if (control.id == controlId) {
-                    if (action == "toggle" && (control.type == CONTROL_SWITCH || control.type == CONTROL_POWER_BUTTON)) {
-                        control.state = !control.state;
-                        logToSerial("Control '" + control.title + "' toggled to " + String(control.state ? "ON" : "OFF"), "CONTROL");
-                        if (control.switchCallback) {
-                            control.switchCallback(control.state);
-                        }
-                    }
-                    else if (action == "click" && control.type == CONTROL_BUTTON) {
-                        logToSerial("Button '" + control.title + "' clicked", "CONTROL");
-                        if (control.buttonCallback) {
-                            control.buttonCallback();
-                        }
-                    }
-                    else if (action == "slide" && control.type == CONTROL_SLIDER) {
-                        control.value = doc["value"];
-                        logToSerial("Slider '" + control.title + "' set to " + String(control.value), "CONTROL");
-                        if (control.sliderCallback) {
-                            control.sliderCallback(control.value);
-                        }
-                    }
-                    break;
-                }
-            }
-            sendDataToClients();
+            card.dirty = true;
+            break;
         }
+    }
 
-        if (onCustomMessage) {
-            onCustomMessage(String((char*)payload), String(num));
+    for (JsonVariant item : doc["controls"].as<JsonArray>()) {
+        String id = prefix + item["id"].as<String>();
+        for (auto& control : controls) {
+            if (control.id != id) continue;
+            control.state = item["state"];
+            if (control.type == CONTROL_SETPOINT) control.setpoint = item["value"];
+            else control.value = item["value"];
+            break;
         }
-        break;
     }
 }
 
-void ESP32Dashboard::sendDataToClients() {
-    DynamicJsonDocument doc(4096);
+void ESP32Dashboard::syncPeerLayout(DashboardPeer& peer, JsonObject layout) {
+    String prefix = peer.getName() + ".";
+
+    removePeerWidgets(peer.getName(), layout);
+
+    for (JsonVariant item : layout["cards"].as<JsonArray>()) {
+        DashboardCard mirror;
+        mirror.remoteId = item["id"].as<String>();
+        mirror.id = prefix + mirror.remoteId;
+        mirror.peer = peer.getName();
+        mirror.title = item["title"].as<String>();
+        mirror.description = item["description"].as<String>();
+        mirror.color = item["color"].as<String>();
+        mirror.icon = item["icon"].as<String>();
+        mirror.type = (CardType)item["type"].as<int>();
+        mirror.maxDataPoints = 0;
+        for (JsonVariant seriesItem : item["series"].as<JsonArray>()) {
+            ChartSeries series;
+            series.label = seriesItem["label"].as<String>();
+            series.color = seriesItem["color"].as<String>();
+            mirror.chartSeries.push_back(series);
+        }
 
-    JsonArray cardArray = doc.createNestedArray("cards");
-    for (auto& card : cards) {
-        JsonObject cardObj = cardArray.createNestedObject();
-        cardObj["id"] = card.id;
-        cardObj["value"] = card.valueCallback ? card.valueCallback() : card.value;
-        cardObj["status"] = card.statusCallback ? card.statusCallback() : card.status;
-        cardObj["type"] = card.type;
-
-        if (card.type == CARD_CHART) {
-            JsonArray chartArray = cardObj.createNestedArray("chartData");
-            for (auto& point : card.chartData) {
-                JsonObject pointObj = chartArray.createNestedObject();
-                pointObj["timestamp"] = point.timestamp;
-                pointObj["value"] = point.value;
-            }
+        DashboardCard* existing = nullptr;
+        for (auto& card : cards) {
+            if (card.id == mirror.id) existing = &card;
+        }
+        if (!existing) {
+            registerCard(mirror);
+            continue;
+        }
+
+        // Re-announce only widgets whose description changed on the peer
+        bool changed = existing->title != mirror.title || existing->description != mirror.description ||
+            existing->color != mirror.color || existing->icon != mirror.icon || existing->type != mirror.type ||
+            existing->chartSeries.size() != mirror.chartSeries.size();
+        for (size_t i = 0; !changed && i < mirror.chartSeries.size(); i++) {
+            changed = existing->chartSeries[i].label != mirror.chartSeries[i].label ||
+                existing->chartSeries[i].color != mirror.chartSeries[i].color;
+        }
+        if (changed) {
+            existing->title = mirror.title;
+            existing->description = mirror.description;
+            existing->color = mirror.color;
+            existing->icon = mirror.icon;
+            existing->type = mirror.type;
+            existing->chartSeries = mirror.chartSeries;
+            publishLayoutChange("add", "card", existing, nullptr);
         }
     }
 
-    JsonArray controlArray = doc.createNestedArray("controls");
-    for (auto& control : controls) {
-        JsonObject controlObj = controlArray.createNestedObject();
-        controlObj["id"] = control.id;
-        controlObj["state"] = control.state;
-        controlObj["value"] = control.value;
+    for (JsonVariant item : layout["controls"].as<JsonArray>()) {
+        DashboardControl mirror;
+        mirror.remoteId = item["id"].as<String>();
+        mirror.id = prefix + mirror.remoteId;
+        mirror.peer = peer.getName();
+        mirror.title = item["title"].as<String>();
+        mirror.description = item["description"].as<String>();
+        mirror.color = item["color"].as<String>();
+        mirror.type = (ControlType)item["type"].as<int>();
+        mirror.state = false;
+        mirror.minValue = item["min"] | 0;
+        mirror.maxValue = item["max"] | 100;
+        mirror.value = mirror.minValue;
+        mirror.rate = item["rate"] | 20;
+        mirror.setpointMin = item["min"] | 0.0f;
+        mirror.setpointMax = item["max"] | 0.0f;
+        mirror.step = item["step"] | 0.0f;
+
+        DashboardControl* existing = nullptr;
+        for (auto& control : controls) {
+            if (control.id == mirror.id) existing = &control;
+        }
+        if (!existing) {
+            registerControl(mirror);
+            continue;
+        }
+
+        bool changed = existing->title != mirror.title || existing->description != mirror.description ||
+            existing->color != mirror.color || existing->type != mirror.type ||
+            existing->minValue != mirror.minValue || existing->maxValue != mirror.maxValue ||
+            existing->rate != mirror.rate || existing->setpointMin != mirror.setpointMin ||
+            existing->setpointMax != mirror.setpointMax || existing->step != mirror.step;
+        if (changed) {
+            existing->title = mirror.title;
+            existing->description = mirror.description;
+            existing->color = mirror.color;
+            existing->type = mirror.type;
+            existing->minValue = mirror.minValue;
+            existing->maxValue = mirror.maxValue;
+            existing->rate = mirror.rate;
+            existing->setpointMin = mirror.setpointMin;
+            existing->setpointMax = mirror.setpointMax;
+            existing->step = mirror.step;
+            publishLayoutChange("add", "control", nullptr, existing);
+        }
     }
 
-    doc["timestamp"] = millis();
-    doc["connectedClients"] = webSocket->connectedClients();
+    peer.setLayoutVersion(layout["version"].as<unsigned long>());
+    logToSerial("Mirrored layout v" + String(peer.getLayoutVersion()) + " of peer '" + peer.getName() + "'", "HUB");
 
-    String jsonString;
-    serializeJson(doc, jsonString);
-    webSocket->broadcastTXT(jsonString);
+    // Values that arrived before their widget existed were dropped
+    peer.send("{\"type\":\"snapshot\"}");
 }
 
-String ESP32Dashboard::generateHTML() {
-    String html = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>)rawliteral";
-
-    html += dashboardTitle;
-    html += R"rawliteral(</title>
-    <style>)rawliteral";
-    html += generateCSS();
-    html += R"rawliteral(</style>
-</head>
-<body>
-    <div class="dashboard-container">
-        <header class="dashboard-header">
-            <div class="header-content">
-                <div class="logo-section">
-                    <div class="logo-icon">📊</div>
-                    <div class="logo-text">
-                        <h1>)rawliteral";
-    html += dashboardTitle;
-    html += R"rawliteral(</h1>
-                        <p>)rawliteral";
-    html += dashboardSubtitle;
-    html += R"rawliteral(</p>
-                    </div>
-                </div>
-                <div class="header-controls">
-                    <div id="connectionStatus" class="status-indicator online">
-                        <div class="status-dot"></div>
-                        <span>Online</span>
-                    </div>
-                    <div id="clientCounter" class="client-counter">
-                        <span>👥 <span id="clientCount">0</span></span>
-                    </div>
-                    <button class="theme-toggle" onclick="toggleTheme()" title="Toggle Theme">
-                        <span id="themeIcon">🌙</span>
-                    </button>
-                </div>
-            </div>
-        </header>
-
-        <main class="dashboard-main">
-            <div class="cards-grid" id="cardsContainer">)rawliteral";
-    html += generateCards();
-    html += R"rawliteral(</div>
-            
-            <div class="controls-section">
-                <h2 class="section-title">🎛️ Controls</h2>
-                <div class="controls-grid" id="controlsContainer">)rawliteral";
-    html += generateControls();
-    html += R"rawliteral(</div>
-            </div>
-        </main>
-    </div>
-
-    <script>)rawliteral";
-    html += generateJavaScript();
-    html += R"rawliteral(</script>
-</body>
-</html>)rawliteral";
-
-    return html;
-}
-
-String ESP32Dashboard::generateCards() {
-    String cardsHTML = "";
+void ESP32Dashboard::removePeerWidgets(const String& name, JsonObject layout) {
+    // Removes the peer's mirrors that are not in layout (all of them when
+    // layout is null)
+    auto inLayout = [&layout](const char* kind, const String& remoteId) -> bool {
+        for (JsonVariant item : layout[kind].as<JsonArray>()) {
+            if (remoteId == item["id"].as<String>()) return true;
+        }
+        return false;
+        };
 
+    std::vector<String> stale;
     for (auto& card : cards) {
-        if (card.type == CARD_CHART) {
-            cardsHTML += R"rawliteral(
-        <div class="dashboard-card chart-card">
-            <div class="card-header">
-                <div class="card-icon">)rawliteral";
-            cardsHTML += card.icon;
-            cardsHTML += R"rawliteral(</div>
-                <div class="card-info">
-                    <h3 class="card-title">)rawliteral";
-            cardsHTML += card.title;
-            cardsHTML += R"rawliteral(</h3>
-                    <p class="card-description">)rawliteral";
-            cardsHTML += card.description;
-            cardsHTML += R"rawliteral(</p>
-                </div>
-            </div>
-            <div class="chart-container">
-                <canvas id=")rawliteral";
-            cardsHTML += card.id;
-            cardsHTML += R"rawliteral(_chart" class="chart-canvas"></canvas>
-            </div>
-            <div class="card-footer">
-                <span class="card-value text-)rawliteral";
-            cardsHTML += card.color;
-            cardsHTML += R"rawliteral(" id=")rawliteral";
-            cardsHTML += card.id;
-            cardsHTML += R"rawliteral(_value">)rawliteral";
-            cardsHTML += card.valueCallback ? card.valueCallback() : card.value;
-            cardsHTML += R"rawliteral(</span>
-                <span class="card-status" id=")rawliteral";
-            cardsHTML += card.id;
-            cardsHTML += R"rawliteral(_status">)rawliteral";
-            cardsHTML += card.statusCallback ? card.statusCallback() : card.status;
-            cardsHTML += R"rawliteral(</span>
-            </div>
-        </div>)rawliteral";
-        }
-        else {
-            cardsHTML += R"rawliteral(
-        <div class="dashboard-card">
-            <div class="card-header">
-                <div class="card-icon">)rawliteral";
-            cardsHTML += card.icon;
-            cardsHTML += R"rawliteral(</div>
-                <div class="card-info">
-                    <h3 class="card-title">)rawliteral";
-            cardsHTML += card.title;
-            cardsHTML += R"rawliteral(</h3>
-                    <p class="card-description">)rawliteral";
-            cardsHTML += card.description;
-            cardsHTML += R"rawliteral(</p>
-                </div>
-            </div>
-            <div class="card-content">
-                <div class="card-value text-)rawliteral";
-            cardsHTML += card.color;
-            cardsHTML += R"rawliteral(" id=")rawliteral";
-            cardsHTML += card.id;
-            cardsHTML += R"rawliteral(_value">)rawliteral";
-            cardsHTML += card.valueCallback ? card.valueCallback() : card.value;
-            cardsHTML += R"rawliteral(</div>
-                <div class="card-status" id=")rawliteral";
-            cardsHTML += card.id;
-            cardsHTML += R"rawliteral(_status">)rawliteral";
-            cardsHTML += card.statusCallback ? card.statusCallback() : card.status;
-            cardsHTML += R"rawliteral(</div>
-            </div>
-        </div>)rawliteral";
-        }
-    }
-
-    return cardsHTML;
-}
-
-String ESP32Dashboard::generateControls() {
-    String controlsHTML = "";
+        if (card.peer == name && !inLayout("cards", card.remoteId)) stale.push_back(card.id);
+    }
+    for (auto& id : stale) removeCard(id.c_str());
 
+    stale.clear();
     for (auto& control : controls) {
-        if (control.type == CONTROL_POWER_BUTTON) {
-            controlsHTML += R"rawliteral(
-        <div class="control-card power-control">
-            <div class="control-header">
-                <h3>)rawliteral";
-            controlsHTML += control.title;
-            controlsHTML += R"rawliteral(</h3>
-                <p>)rawliteral";
-            controlsHTML += control.description;
-            controlsHTML += R"rawliteral(</p>
-            </div>
-            <div class="power-button-container">
-                <button class="power-button" id=")rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(" onclick="toggleControl(')rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(')">
-                    <div class="power-icon">⚡</div>
-                    <span id=")rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(_text">OFF</span>
-                </button>
-            </div>
-            <div class="power-status" id=")rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(_status">
-                <span>System Inactive</span>
-            </div>
-        </div>)rawliteral";
-        }
-        else if (control.type == CONTROL_SWITCH) {
-            controlsHTML += R"rawliteral(
-        <div class="control-card">
-            <div class="control-header">
-                <div class="control-info">
-                    <h3>)rawliteral";
-            controlsHTML += control.title;
-            controlsHTML += R"rawliteral(</h3>
-                    <p>)rawliteral";
-            controlsHTML += control.description;
-            controlsHTML += R"rawliteral(</p>
-                </div>
-                <div class="control-indicator" id=")rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(_indicator"></div>
-            </div>
-            <div class="switch-container">
-                <label class="switch">
-                    <input type="checkbox" id=")rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(_input" onchange="toggleControl(')rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(')">
-                    <span class="switch-slider"></span>
-                </label>
-                <span class="switch-status" id=")rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(_status">OFF</span>
-            </div>
-        </div>)rawliteral";
-        }
-        else if (control.type == CONTROL_BUTTON) {
-            controlsHTML += R"rawliteral(
-        <div class="control-card">
-            <div class="control-header">
-                <h3>)rawliteral";
-            controlsHTML += control.title;
-            controlsHTML += R"rawliteral(</h3>
-                <p>)rawliteral";
-            controlsHTML += control.description;
-            controlsHTML += R"rawliteral(</p>
-            </div>
-            <button class="action-button bg-)rawliteral";
-            controlsHTML += control.color;
-            controlsHTML += R"rawliteral(" id=")rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(" onclick="clickControl(')rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(')">
-                Execute
-            </button>
-        </div>)rawliteral";
-        }
-        else if (control.type == CONTROL_SLIDER) {
-            controlsHTML += R"rawliteral(
-        <div class="control-card">
-            <div class="control-header">
-                <h3>)rawliteral";
-            controlsHTML += control.title;
-            controlsHTML += R"rawliteral(</h3>
-                <p>)rawliteral";
-            controlsHTML += control.description;
-            controlsHTML += R"rawliteral(</p>
-            </div>
-            <div class="slider-container">
-                <input type="range" class="slider" id=")rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(_input" min=")rawliteral";
-            controlsHTML += String(control.minValue);
-            controlsHTML += R"rawliteral(" max=")rawliteral";
-            controlsHTML += String(control.maxValue);
-            controlsHTML += R"rawliteral(" value=")rawliteral";
-            controlsHTML += String(control.value);
-            controlsHTML += R"rawliteral(" oninput="slideControl(')rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(', this.value)">
-                <div class="slider-value">
-                    <span id=")rawliteral";
-            controlsHTML += control.id;
-            controlsHTML += R"rawliteral(_value">)rawliteral";
-            controlsHTML += String(control.value);
-            controlsHTML += R"rawliteral(</span>
-                </div>
-            </div>
-        </div>)rawliteral";
-        }
-    }
-
-    return controlsHTML;
-}
-
-String ESP32Dashboard::generateCSS() {
-    return R"rawliteral(
-    * {
-        margin: 0;
-        padding: 0;
-        box-sizing: border-box;
-    }
-
-    :root {
-        --primary-color: #3b82f6;
-        --secondary-color: #64748b;
-        --success-color: #22c55e;
-        --warning-color: #f59e0b;
-        --danger-color: #ef4444;
-        --info-color: #06b6d4;
-        --purple-color: #a855f7;
-        --orange-color: #f97316;
-        
-        --bg-primary: #ffffff;
-        --bg-secondary: #f8fafc;
-        --bg-tertiary: #f1f5f9;
-        --text-primary: #0f172a;
-        --text-secondary: #64748b;
-        --border-color: #e2e8f0;
-        --shadow: 0 4px 6px -1px rgba(0, 0, 0, 0.1);
-        --shadow-lg: 0 10px 15px -3px rgba(0, 0, 0, 0.1);
-    }
-
-    body {
-        font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif;
-        background: linear-gradient(135deg, var(--bg-secondary) 0%, var(--bg-tertiary) 100%);
-        color: var(--text-primary);
-        min-height: 100vh;
-        transition: all 0.3s ease;
-    }
-
-    body.dark {
-        --bg-primary: #1e293b;
-        --bg-secondary: #0f172a;
-        --bg-tertiary: #334155;
-        --text-primary: #f8fafc;
-        --text-secondary: #94a3b8;
-        --border-color: #334155;
-    }
-
-    .dashboard-container {
-        max-width: 1400px;
-        margin: 0 auto;
-        padding: 0 1rem;
-    }
-
-    .dashboard-header {
-        background: var(--bg-primary);
-        border-bottom: 1px solid var(--border-color);
-        padding: 1rem 0;
-        margin-bottom: 2rem;
-        box-shadow: var(--shadow);
-        position: sticky;
-        top: 0;
-        z-index: 100;
-        backdrop-filter: blur(10px);
-    }
-
-    .header-content {
-        display: flex;
-        justify-content: space-between;
-        align-items: center;
-        flex-wrap: wrap;
-        gap: 1rem;
-    }
-
-    .logo-section {
-        display: flex;
-        align-items: center;
-        gap: 1rem;
-    }
-
-    .logo-icon {
-        width: 3rem;
-        height: 3rem;
-        background: linear-gradient(135deg, var(--primary-color), var(--info-color));
-        border-radius: 0.75rem;
-        display: flex;
-        align-items: center;
-        justify-content: center;
-        font-size: 1.5rem;
-        color: white;
-        box-shadow: var(--shadow);
-    }
-
-    .logo-text h1 {
-        font-size: 1.5rem;
-        font-weight: 700;
-        margin-bottom: 0.25rem;
+        if (control.peer == name && !inLayout("controls", control.remoteId)) stale.push_back(control.id);
     }
+    for (auto& id : stale) removeControl(id.c_str());
+}
 
-    .logo-text p {
-        color: var(--text-secondary);
-        font-size: 0.875rem;
-    }
-
-    .header-controls {
-        display: flex;
-        align-items: center;
-        gap: 1rem;
-    }
-
-    .status-indicator {
-        display: flex;
-        align-items: center;
-        gap: 0.5rem;
-        padding: 0.5rem 1rem;
-        border-radius: 9999px;
-        font-size: 0.875rem;
-        font-weight: 500;
-        transition: all 0.3s ease;
+bool ESP32Dashboard::enableEspNow() {
+    if (!espNow.begin()) {
+        logToSerial("❌ ESP-NOW init failed", "ESPNOW");
+        return false;
     }
+    logToSerial("ESP-NOW receiver started on channel " + String(WiFi.channel()), "ESPNOW");
+    return true;
+}
 
-    .status-indicator.online {
-        background: var(--success-color);
-        color: white;
+bool ESP32Dashboard::addEspNowNode(const char* name, const uint8_t* mac, unsigned long staleAfter) {
+    for (auto& node : espNowNodes) {
+        if (node.name == name || memcmp(node.mac, mac, sizeof(node.mac)) == 0) return false;
     }
 
-    .status-indicator.offline {
-        background: var(--danger-color);
-        color: white;
-    }
+    EspNowNode node;
+    node.name = name;
+    memcpy(node.mac, mac, sizeof(node.mac));
+    node.staleAfter = staleAfter;
+    node.lastSeen = millis();
+    espNowNodes.push_back(node);
+    return true;
+}
 
-    .status-dot {
-        width: 0.5rem;
-        height: 0.5rem;
-        border-radius: 50%;
-        background: currentColor;
-        animation: pulse 2s infinite;
+bool ESP32Dashboard::mapEspNowChannel(const char* node, uint8_t channel, const char* cardId) {
+    for (auto& espNowNode : espNowNodes) {
+        if (espNowNode.name == node) {
+            espNowNode.channels.push_back(std::make_pair(channel, String(cardId)));
+            return true;
+        }
     }
+    return false;
+}
 
-    .client-counter {
-        background: var(--info-color);
-        color: white;
-        padding: 0.5rem 1rem;
-        border-radius: 9999px;
-        font-size: 0.875rem;
-        font-weight: 500;
+bool ESP32Dashboard::isEspNowNodeStale(const char* node) {
+    for (auto& espNowNode : espNowNodes) {
+        if (espNowNode.name == node) return espNowNode.stale;
     }
+    return true;
+}
 
-    .theme-toggle {
-        width: 2.5rem;
-        height: 2.5rem;
-        border: none;
-        background: var(--bg-tertiary);
-        border-radius: 50%;
-        cursor: pointer;
-        font-size: 1.25rem;
-        transition: all 0.3s ease;
-        display: flex;
-        align-items: center;
-        justify-content: center;
-    }
+void ESP32Dashboard::serviceEspNow() {
+    if (!espNow.isRunning()) return;
 
-    .theme-toggle:hover {
-        background: var(--border-color);
-        transform: scale(1.1);
-    }
+    espNow.drain([this](const uint8_t* mac, const DashboardEspNowPacket& packet) {
+        handleEspNowPacket(mac, packet);
+        });
 
-    .dashboard-main {
-        padding-bottom: 2rem;
-    }
+    unsigned long now = millis();
+    for (auto& node : espNowNodes) {
+        bool stale = now - node.lastSeen > node.staleAfter;
+        if (stale == node.stale) continue;
 
-    .cards-grid {
-        display: grid;
-        grid-template-columns: repeat(auto-fit, minmax(300px, 1fr));
-        gap: 1.5rem;
-        margin-bottom: 3rem;
+        node.stale = stale;
+        logToSerial("Node '" + node.name + "' " + (stale ? "is stale" : "is back"), "ESPNOW");
+        for (auto& channel : node.channels) {
+            setCardStale(channel.second, stale ? "⚠️ " + node.name + " silent" : "");
+        }
     }
+}
 
-    .dashboard-card {
-        background: var(--bg-primary);
-        border: 1px solid var(--border-color);
-        border-radius: 1rem;
-        padding: 1.5rem;
-        box-shadow: var(--shadow);
-        transition: all 0.3s ease;
-        position: relative;
-        overflow: hidden;
+void ESP32Dashboard::handleEspNowPacket(const uint8_t* mac, const DashboardEspNowPacket& packet) {
+    EspNowNode* node = nullptr;
+    for (auto& espNowNode : espNowNodes) {
+        if (memcmp(espNowNode.mac, mac, sizeof(espNowNode.mac)) == 0) node = &espNowNode;
     }
-
-    .dashboard-card:hover {
-        transform: translateY(-4px);
-        box-shadow: var(--shadow-lg);
+    if (!node) {
+        char address[18];
+        snprintf(address, sizeof(address), "%02X:%02X:%02X:%02X:%02X:%02X", mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+        logToSerial("Packet from unknown node " + String(address), "ESPNOW");
+        return;
     }
 
-    .card-header {
-        display: flex;
-        align-items: center;
-        gap: 1rem;
-        margin-bottom: 1rem;
+    // Sequence gaps are packets lost on air (or sent while we were busy)
+    if (node->packets > 0) {
+        uint16_t gap = packet.sequence - node->lastSequence - 1;
+        if (gap < 0x8000) node->lost += gap;
     }
+    node->lastSequence = packet.sequence;
+    node->lastSeen = millis();
+    node->packets++;
 
-    .card-icon {
-        font-size: 2rem;
-        width: 3rem;
-        height: 3rem;
-        display: flex;
-        align-items: center;
-        justify-content: center;
-        background: var(--bg-tertiary);
-        border-radius: 0.75rem;
+    for (uint8_t i = 0; i < packet.count; i++) {
+        const DashboardEspNowReading& reading = packet.readings[i];
+        for (auto& channel : node->channels) {
+            if (channel.first == reading.channel) addCardSample(channel.second.c_str(), reading.value);
+        }
     }
+}
 
-    .card-info h3 {
-        font-size: 1.125rem;
-        font-weight: 600;
-        margin-bottom: 0.25rem;
+void ESP32Dashboard::setCardStale(const String& id, const String& staleStatus) {
+    for (auto& card : cards) {
+        if (card.id == id) {
+            if (card.staleStatus == staleStatus) return;
+            card.staleStatus = staleStatus;
+            // Force the next update to carry the new status either way
+            card.reported = false;
+
+            // Rules skipped while stale; the value may come back unchanged
+            if (staleStatus.length() == 0) queueCardRules(card);
+            return;
+        }
     }
+}
 
-    .card-info p {
-        color: var(--text-secondary);
-        font-size: 0.875rem;
-    }
+void ESP32Dashboard::enableMqtt(DashboardMqttTransport& transport, const char* baseTopic) {
+    mqtt = &transport;
+    mqttBaseTopic = baseTopic;
+    mqttConnected = false;
+    mqttLastAttempt = 0;
+    mqtt->onMessage = [this](const String& topic, const String& payload) {
+        handleMqttMessage(topic, payload);
+        };
+}
 
-    .card-content {
-        text-align: center;
-    }
+bool ESP32Dashboard::isMqttConnected() {
+    return mqttConnected;
+}
 
-    .card-value {
-        font-size: 2.5rem;
-        font-weight: 700;
-        margin-bottom: 0.5rem;
-        display: block;
-    }
+void ESP32Dashboard::serviceMqtt() {
+    if (!mqtt) return;
 
-    .card-status {
-        color: var(--text-secondary);
-        font-size: 0.875rem;
+    bool connected = mqtt->connected();
+    if (!connected && (mqttLastAttempt == 0 || millis() - mqttLastAttempt >= 5000)) {
+        mqttLastAttempt = millis();
+        connected = mqtt->connect();
     }
+    if (connected) mqtt->loop();
 
-    .chart-card {
-        grid-column: span 2;
-    }
+    if (connected == mqttConnected) return;
+    mqttConnected = connected;
+    logToSerial(connected ? "Connected to MQTT broker" : "MQTT broker connection lost", "MQTT");
+    if (!connected) return;
 
-    .chart-container {
-        height: 200px;
-        margin: 1rem 0;
-        position: relative;
+    // A new session starts with the current value of everything; after that
+    // only what sendDataToClients() reports as changed is published
+    mqtt->subscribe(mqttBaseTopic + "/control/+/set");
+    mqtt->publish(mqttBaseTopic + "/status", "online", true);
+    for (auto& card : cards) {
+        if (card.reported) publishCardMqtt(card);
     }
-
-    .chart-canvas {
-        width: 100%;
-        height: 100%;
+    for (auto& control : controls) {
+        publishControlMqtt(control);
     }
+}
 
-    .card-footer {
-        display: flex;
-        justify-content: space-between;
-        align-items: center;
-        margin-top: 1rem;
-        padding-top: 1rem;
-        border-top: 1px solid var(--border-color);
+void ESP32Dashboard::publishCardMqtt(const DashboardCard& card) {
+    DashboardJsonDocument doc(384);
+    doc["value"] = card.value;
+    doc["status"] = card.staleStatus.length() > 0 ? card.staleStatus : card.status;
+    if (card.numericCallback || card.filter.hasValue()) {
+        doc["numeric"] = card.numericValue;
     }
+    doc["timestamp"] = clock.now();
 
-    .section-title {
-        font-size: 1.5rem;
-        font-weight: 700;
-        margin-bottom: 1.5rem;
-        color: var(--text-primary);
-    }
+    String payload;
+    serializeJson(doc, payload);
+    mqtt->publish(mqttBaseTopic + "/card/" + card.id, payload, true);
+}
 
-    .controls-grid {
-        display: grid;
-        grid-template-columns: repeat(auto-fit, minmax(300px, 1fr));
-        gap: 1.5rem;
-    }
+void ESP32Dashboard::publishControlMqtt(const DashboardControl& control) {
+    DashboardJsonDocument doc(128);
+    doc["state"] = control.state;
+    if (control.type == CONTROL_SETPOINT) doc["value"] = control.setpoint;
+    else doc["value"] = control.value;
 
-    .control-card {
-        background: var(--bg-primary);
-        border: 1px solid var(--border-color);
-        border-radius: 1rem;
-        padding: 1.5rem;
-        box-shadow: var(--shadow);
-        transition: all 0.3s ease;
-    }
+    String payload;
+    serializeJson(doc, payload);
+    mqtt->publish(mqttBaseTopic + "/control/" + control.id, payload, true);
+}
 
-    .control-card:hover {
-        transform: translateY(-2px);
-        box-shadow: var(--shadow-lg);
-    }
+void ESP32Dashboard::handleMqttMessage(const String& topic, const String& payload) {
+    String prefix = mqttBaseTopic + "/control/";
+    if (!topic.startsWith(prefix) || !topic.endsWith("/set")) return;
+    String id = topic.substring(prefix.length(), topic.length() - 4);
 
-    .control-header {
-        display: flex;
-        justify-content: space-between;
-        align-items: flex-start;
-        margin-bottom: 1rem;
-    }
+    logToSerial("Message on " + topic + ": " + payload, "MQTT");
 
-    .control-info h3 {
-        font-size: 1.125rem;
-        font-weight: 600;
-        margin-bottom: 0.25rem;
-    }
+    String command = payload;
+    command.trim();
+    command.toLowerCase();
 
-    .control-info p {
-        color: var(--text-secondary);
-        font-size: 0.875rem;
-    }
+    for (auto& control : controls) {
+        if (control.id != id) continue;
 
-    .control-indicator {
-        width: 0.75rem;
-        height: 0.75rem;
-        border-radius: 50%;
-        background: var(--text-secondary);
-        transition: all 0.3s ease;
+        // Switches take an explicit state as well as "toggle"
+        if (control.type == CONTROL_SWITCH || control.type == CONTROL_POWER_BUTTON) {
+            bool on = command == "on" || command == "1" || command == "true";
+            bool off = command == "off" || command == "0" || command == "false";
+            if (command == "toggle" || (on && !control.state) || (off && control.state)) {
+                applyControlAction(id, "toggle", 0);
+            }
+        }
+        else if (control.type == CONTROL_BUTTON) {
+            applyControlAction(id, "click", 0);
+        }
+        else if (control.type == CONTROL_SLIDER) {
+            applyControlAction(id, "slide", command.toFloat());
+        }
+        else if (control.type == CONTROL_SETPOINT) {
+            applyControlAction(id, "set", command.toFloat());
+        }
+        else if (control.type == CONTROL_JOYSTICK) {
+            // "x,y"
+            int comma = command.indexOf(',');
+            if (comma > 0) applyControlAction(id, "move", command.substring(0, comma).toFloat(), command.substring(comma + 1).toFloat());
+        }
+        break;
     }
 
-    .control-indicator.active {
-        background: var(--success-color);
-        animation: pulse 2s infinite;
-    }
+    sendDataToClients();
+}
 
-    .switch-container {
-        display: flex;
-        align-items: center;
-        justify-content: space-between;
-    }
+bool ESP32Dashboard::enableModbus(uint16_t port) {
+    if (modbus) return true;
 
-    .switch {
-        position: relative;
-        display: inline-block;
-        width: 3.5rem;
-        height: 2rem;
-    }
+    modbus = new DashboardModbus();
+    modbus->readInputRegister = [this](uint16_t address, uint16_t& value) {
+        return readModbusInput(address, value);
+        };
+    modbus->readCoil = [this](uint16_t address, bool& value) {
+        for (auto& control : controls) {
+            if (control.modbusAddress == address && control.type != CONTROL_SLIDER) {
+                value = control.state;
+                return true;
+            }
+        }
+        return false;
+        };
+    modbus->readHoldingRegister = [this](uint16_t address, uint16_t& value) {
+        for (auto& control : controls) {
+            if (control.modbusAddress == address && control.type == CONTROL_SLIDER) {
+                value = (uint16_t)(int16_t)control.value;
+                return true;
+            }
+        }
+        return false;
+        };
+    modbus->writeCoil = [this](uint16_t address, bool value) {
+        return writeModbusCoil(address, value);
+        };
+    modbus->writeHoldingRegister = [this](uint16_t address, uint16_t value) {
+        return writeModbusHolding(address, value);
+        };
+    modbus->begin(port);
 
-    .switch input {
-        opacity: 0;
-        width: 0;
-        height: 0;
+    logToSerial("Modbus TCP server started on port " + String(port), "MODBUS");
+    for (auto& card : cards) {
+        if (card.modbusRegister < 0) continue;
+        logToSerial("Input registers " + String(card.modbusRegister) + "-" + String(card.modbusRegister + 1) + ": " + card.title + " (" + card.id + ")", "MODBUS");
     }
-
-    .switch-slider {
-        position: absolute;
-        cursor: pointer;
-        top: 0;
-        left: 0;
-        right: 0;
-        bottom: 0;
-        background-color: var(--text-secondary);
-        transition: 0.3s;
-        border-radius: 2rem;
+    for (auto& control : controls) {
+        if (control.modbusAddress < 0) continue;
+        String kind = control.type == CONTROL_SLIDER ? "Holding register " : "Coil ";
+        logToSerial(kind + String(control.modbusAddress) + ": " + control.title + " (" + control.id + ")", "MODBUS");
     }
+    return true;
+}
 
-    .switch-slider:before {
-        position: absolute;
-        content: "";
-        height: 1.5rem;
-        width: 1.5rem;
-        left: 0.25rem;
-        bottom: 0.25rem;
-        background-color: white;
-        transition: 0.3s;
-        border-radius: 50%;
-        box-shadow: 0 2px 4px rgba(0, 0, 0, 0.2);
+int ESP32Dashboard::getModbusAddress(const char* id) {
+    for (auto& card : cards) {
+        if (card.id == id) return card.modbusRegister;
     }
-
-    .switch input:checked + .switch-slider {
-        background-color: var(--success-color);
+    for (auto& control : controls) {
+        if (control.id == id) return control.modbusAddress;
     }
+    return -1;
+}
 
-    .switch input:checked + .switch-slider:before {
-        transform: translateX(1.5rem);
+int ESP32Dashboard::getControlHandle(const char* id) {
+    for (auto& control : controls) {
+        if (control.id == id) return control.handle;
     }
+    return -1;
+}
 
-    .switch-status {
-        font-weight: 500;
-        color: var(--text-secondary);
-    }
+bool ESP32Dashboard::readModbusInput(uint16_t address, uint16_t& value) {
+    for (auto& card : cards) {
+        if (card.modbusRegister < 0 || address < card.modbusRegister || address > card.modbusRegister + 1) continue;
 
-    .power-control {
-        text-align: center;
+        // Served from the per-update sample cache. Cards that never held a
+        // number (text-only, mirrored from a peer) and stale sources read as NaN
+        bool numeric = card.revision > 0 && card.staleStatus.length() == 0;
+        float reading = numeric ? card.numericValue : NAN;
+        uint32_t bits;
+        memcpy(&bits, &reading, sizeof(bits));
+        value = address == card.modbusRegister ? bits >> 16 : bits & 0xFFFF;
+        return true;
     }
+    return false;
+}
 
-    .power-button-container {
-        margin: 1.5rem 0;
-    }
+bool ESP32Dashboard::writeModbusCoil(uint16_t address, bool value) {
+    for (auto& control : controls) {
+        if (control.modbusAddress != address || control.type == CONTROL_SLIDER) continue;
 
-    .power-button {
-        width: 5rem;
-        height: 5rem;
-        border-radius: 50%;
-        border: 3px solid var(--text-secondary);
-        background: linear-gradient(135deg, var(--bg-tertiary), var(--bg-secondary));
-        cursor: pointer;
-        transition: all 0.3s ease;
-        display: flex;
-        flex-direction: column;
-        align-items: center;
-        justify-content: center;
-        font-weight: 600;
-        color: var(--text-primary);
+        if (control.type == CONTROL_BUTTON) {
+            if (value) applyControlAction(control.id, "click", 0);
+        }
+        else if (value != control.state) {
+            applyControlAction(control.id, "toggle", 0);
+        }
+        return true;
     }
+    return false;
+}
 
-    .power-button:hover {
-        transform: scale(1.05);
+bool ESP32Dashboard::writeModbusHolding(uint16_t address, uint16_t value) {
+    for (auto& control : controls) {
+        if (control.modbusAddress != address || control.type != CONTROL_SLIDER) continue;
+        applyControlAction(control.id, "slide", (int16_t)value);
+        return true;
     }
+    return false;
+}
 
-    .power-button.active {
-        border-color: var(--success-color);
-        background: linear-gradient(135deg, var(--success-color), #16a34a);
-        color: white;
-        box-shadow: 0 0 20px rgba(34, 197, 94, 0.3);
+bool ESP32Dashboard::startRecording(size_t maxBytes, bool includeFrames) {
+    if (!recorder.start(maxBytes, includeFrames)) {
+        logToSerial("Cannot start recording while a replay is running", "RECORD");
+        return false;
     }
+    logToSerial("Recording started (" + String((unsigned long)maxBytes) + " bytes" + (includeFrames ? ", with frames)" : ")"), "RECORD");
+    return true;
+}
 
-    .power-icon {
-        font-size: 1.5rem;
-        margin-bottom: 0.25rem;
-    }
+void ESP32Dashboard::stopRecording() {
+    recorder.stop();
+    logToSerial("Recording stopped: " + String((unsigned long)recorder.getEvents().size()) + " events, " + String(recorder.getDropped()) + " dropped", "RECORD");
+}
 
-    .power-status {
-        color: var(--text-secondary);
-        font-size: 0.875rem;
-    }
+bool ESP32Dashboard::isRecording() {
+    return recorder.isRecording();
+}
+
+bool ESP32Dashboard::replayRecording(float speed) {
+    if (!recorder.startReplay(speed)) return false;
+    logToSerial("Replaying " + String((unsigned long)recorder.getEvents().size()) + " events at " + String(speed, 1) + "x", "RECORD");
+    return true;
+}
+
+bool ESP32Dashboard::isReplaying() {
+    return recorder.isReplaying();
+}
 
-    .power-status.active {
-        color: var(--success-color);
+void ESP32Dashboard::serviceReplay() {
+    if (!recorder.isReplaying()) return;
+
+    // Replayed messages take the path live traffic takes. Connects and
+    // disconnects are only logged: the recorded client slot may not exist
+    // now, so there is no socket to query or send a snapshot to.
+    while (const RecordedEvent* event = recorder.nextDue()) {
+        uint8_t client = event->client;
+        String payload = event->payload;
+        switch (event->type) {
+        case EVENT_CONNECT:
+            logToSerial("Replayed connect of client #" + String(client), "RECORD");
+            break;
+        case EVENT_DISCONNECT:
+            logToSerial("Replayed disconnect of client #" + String(client), "RECORD");
+            break;
+        case EVENT_WS_MESSAGE:
+            webSocketEvent(client, WStype_TEXT, (uint8_t*)payload.c_str(), payload.length());
+            break;
+        case EVENT_HTTP_CONTROL:
+            processControlRequest(payload);
+            sendDataToClients();
+            break;
+        default:
+            break;
+        }
     }
 
-    .action-button {
-        width: 100%;
-        padding: 0.75rem 1.5rem;
-        border: none;
-        border-radius: 0.5rem;
-        font-weight: 600;
-        cursor: pointer;
-        transition: all 0.3s ease;
-        color: white;
+    if (!recorder.isReplaying()) {
+        logToSerial("Replay finished", "RECORD");
     }
+}
 
-    .action-button:hover {
-        transform: translateY(-1px);
-        box-shadow: var(--shadow);
+void ESP32Dashboard::serviceControls() {
+    unsigned long now = millis();
+    for (auto& control : controls) {
+        if (control.peer.length() > 0) continue;
+
+        if (control.type == CONTROL_JOYSTICK) {
+            // A client that stops streaming (closed tab, lost link) must not
+            // leave the stick deflected
+            unsigned long timeout = std::max(250UL, 5000UL / control.rate);
+            if ((control.x != 0 || control.y != 0) && !control.moved && now - control.lastInput > timeout) {
+                control.x = 0;
+                control.y = 0;
+                control.moved = true;
+                logToSerial("Joystick '" + control.title + "' recentred, position stream stopped", "CONTROL");
+            }
+
+            if (!control.moved) continue;
+            control.moved = false;
+            if (control.joystickCallback) {
+                control.joystickCallback(control.x, control.y);
+            }
+        }
+        else if (control.type == CONTROL_SETPOINT && control.pendingCommit) {
+            // Typing or spinning through values commits only where the user stops
+            if (now - control.lastInput < control.debounce) continue;
+            control.pendingCommit = false;
+            if (control.setpoint == control.committedSetpoint) continue;
+
+            control.committedSetpoint = control.setpoint;
+            logToSerial("Setpoint '" + control.title + "' committed " + String(control.setpoint, 3), "CONTROL");
+            if (control.setpointCallback) {
+                control.setpointCallback(control.setpoint);
+            }
+        }
     }
+}
 
-    .slider-container {
-        display: flex;
-        flex-direction: column;
-        gap: 1rem;
+bool ESP32Dashboard::validateSetpoint(const DashboardControl& control, float value, float& result) {
+    if (!std::isfinite(value)) return false;
+
+    result = constrain(value, control.setpointMin, control.setpointMax);
+    if (control.step > 0) {
+        // Snap to the step grid anchored at min, staying inside the range
+        float steps = roundf((result - control.setpointMin) / control.step);
+        result = control.setpointMin + steps * control.step;
+        if (result > control.setpointMax) result -= control.step;
     }
+    return true;
+}
 
-    .slider {
-        width: 100%;
-        height: 0.5rem;
-        border-radius: 0.25rem;
-        background: var(--bg-tertiary);
-        outline: none;
-        -webkit-appearance: none;
-        transition: all 0.3s ease;
+int ESP32Dashboard::addRule(const char* cardId, RuleCondition condition, float threshold, const char* controlId, float activeValue, float inactiveValue, float hysteresis, unsigned long delay) {
+    DashboardCard* card = findCard(cardId);
+    bool controlExists = false;
+    for (auto& control : controls) {
+        if (control.id == controlId) controlExists = true;
     }
+    if (!card || !controlExists) {
+        logToSerial("Rule on '" + String(cardId) + "' -> '" + String(controlId) + "': unknown card or control", "ERROR");
+        return -1;
+    }
+    if (delay > DashboardTimerWheel::MAX_DELAY) {
+        logToSerial("Rule on '" + String(cardId) + "': delay too long", "ERROR");
+        return -1;
+    }
+
+    DashboardRule rule;
+    rule.card = getCardHandle(cardId);
+    rule.condition = condition;
+    rule.threshold = threshold;
+    rule.hysteresis = fabsf(hysteresis);
+    rule.delay = delay;
+    rule.controlId = controlId;
+    rule.activeValue = activeValue;
+    rule.inactiveValue = inactiveValue;
+
+    uint16_t index = rules.size();
+    rules.push_back(rule);
+    card->rules.push_back(index);
 
-    .slider::-webkit-slider-thumb {
-        appearance: none;
-        width: 1.5rem;
-        height: 1.5rem;
-        border-radius: 50%;
-        background: var(--primary-color);
-        cursor: pointer;
-        box-shadow: var(--shadow);
-        transition: all 0.3s ease;
+    // A card that already has a value is checked right away
+    if (card->revision > 0) {
+        rules[index].pending = true;
+        pendingRules.push_back(index);
     }
+    return index;
+}
+
+void ESP32Dashboard::setRuleEnabled(int rule, bool enabled) {
+    if (rule < 0 || rule >= (int)rules.size()) return;
+    rules[rule].enabled = enabled;
+    cancelRuleDelay(rules[rule]);
 
-    .slider::-webkit-slider-thumb:hover {
-        transform: scale(1.1);
+    // Re-enabled rules start from the current value
+    if (enabled && !rules[rule].pending) {
+        rules[rule].pending = true;
+        pendingRules.push_back(rule);
     }
+}
+
+bool ESP32Dashboard::isRuleActive(int rule) {
+    if (rule < 0 || rule >= (int)rules.size()) return false;
+    return rules[rule].active;
+}
 
-    .slider::-moz-range-thumb {
-        width: 1.5rem;
-        height: 1.5rem;
-        border-radius: 50%;
-        background: var(--primary-color);
-        cursor: pointer;
-        border: none;
-        box-shadow: var(--shadow);
-    }
+void ESP32Dashboard::serviceRules() {
+    if (pendingRules.empty()) return;
 
-    .slider-value {
-        text-align: center;
-        font-weight: 600;
-        font-size: 1.125rem;
-        color: var(--primary-color);
-    }
-
-    /* Color utilities */
-    .text-blue { color: var(--primary-color); }
-    .text-green { color: var(--success-color); }
-    .text-orange { color: var(--orange-color); }
-    .text-red { color: var(--danger-color); }
-    .text-purple { color: var(--purple-color); }
-    .text-cyan { color: var(--info-color); }
-    .text-yellow { color: var(--warning-color); }
+    // Only rules whose input changed; delays run on the timer wheel. An
+    // action that changes a rule's input again is evaluated on the next pass.
+    size_t count = pendingRules.size();
+    for (size_t i = 0; i < count; i++) {
+        uint16_t index = pendingRules[i];
+        rules[index].pending = false;
+        evaluateRule(index, false);
+    }
+    pendingRules.erase(pendingRules.begin(), pendingRules.begin() + count);
+}
 
-    .bg-blue { background: var(--primary-color); }
-    .bg-green { background: var(--success-color); }
-    .bg-orange { background: var(--orange-color); }
-    .bg-red { background: var(--danger-color); }
-    .bg-purple { background: var(--purple-color); }
-    .bg-cyan { background: var(--info-color); }
-    .bg-yellow { background: var(--warning-color); }
+void ESP32Dashboard::evaluateRule(uint16_t index, bool delayElapsed) {
+    DashboardRule& rule = rules[index];
+    if (!rule.enabled) return;
 
-    @keyframes pulse {
-        0%, 100% { opacity: 1; }
-        50% { opacity: 0.5; }
+    DashboardCard* card = findCard(rule.card);
+    if (!card || card->revision == 0 || card->staleStatus.length() > 0) {
+        cancelRuleDelay(rule);
+        return;
     }
 
-    @media (max-width: 768px) {
-        .dashboard-container {
-            padding: 0 0.5rem;
-        }
-        
-        .cards-grid {
-            grid-template-columns: 1fr;
-        }
-        
-        .chart-card {
-            grid-column: span 1;
-        }
-        
-        .controls-grid {
-            grid-template-columns: 1fr;
-        }
-        
-        .card-value {
-            font-size: 2rem;
-        }
-        
-        .power-button {
-            width: 4rem;
-            height: 4rem;
-        }
-    }
-  )rawliteral";
-}
-
-String ESP32Dashboard::generateJavaScript() {
-    return R"rawliteral(
-    let ws;
-    let isDarkMode = false;
-    let reconnectAttempts = 0;
-    const maxReconnectAttempts = 5;
-    const charts = {};
-
-    document.addEventListener('DOMContentLoaded', function() {
-        initWebSocket();
-        loadTheme();
-    });
-
-    function initWebSocket() {
-        const protocol = window.location.protocol === 'https:' ? 'wss:' : 'ws:';
-        const wsUrl = `${protocol}//${window.location.hostname}:81`;
-        
-        console.log('Connecting to WebSocket:', wsUrl);
-        ws = new WebSocket(wsUrl);
-        
-        ws.onopen = function() {
-            console.log('✅ WebSocket connected');
-            reconnectAttempts = 0;
-            updateConnectionStatus(true);
-        };
-        
-        ws.onmessage = function(event) {
-            try {
-                const data = JSON.parse(event.data);
-                updateUI(data);
-            } catch (error) {
-                console.error('❌ Error parsing WebSocket data:', error);
-            }
-        };
-        
-        ws.onclose = function() {
-            console.log('❌ WebSocket disconnected');
-            updateConnectionStatus(false);
-            
-            if (reconnectAttempts < maxReconnectAttempts) {
-                reconnectAttempts++;
-                const delay = Math.min(1000 * Math.pow(2, reconnectAttempts), 30000);
-                console.log(`🔄 Reconnecting in ${delay}ms (attempt ${reconnectAttempts}/${maxReconnectAttempts})`);
-                setTimeout(initWebSocket, delay);
-            } else {
-                console.log('❌ Max reconnection attempts reached');
-            }
-        };
-        
-        ws.onerror = function(error) {
-            console.error('❌ WebSocket error:', error);
-        };
+    // Once active, the value has to come back past the hysteresis band
+    float value = card->numericValue;
+    bool active;
+    if (rule.condition == RULE_ABOVE) {
+        active = rule.active ? value >= rule.threshold - rule.hysteresis : value > rule.threshold;
+    }
+    else {
+        active = rule.active ? value <= rule.threshold + rule.hysteresis : value < rule.threshold;
     }
 
-    function updateUI(data) {
-        console.log('📊 Updating UI with data:', data);
-        
-        // Update client count
-        if (data.connectedClients !== undefined) {
-            const clientCountEl = document.getElementById('clientCount');
-            if (clientCountEl) {
-                clientCountEl.textContent = data.connectedClients;
-            }
-        }
-        
-        // Update cards
-        if (data.cards) {
-            data.cards.forEach(card => {
-                const valueEl = document.getElementById(card.id + '_value');
-                const statusEl = document.getElementById(card.id + '_status');
-                
-                if (valueEl) {
-                    valueEl.textContent = card.value;
-                    console.log(`📊 Updated ${card.id} value: ${card.value}`);
-                }
-                if (statusEl) {
-                    statusEl.textContent = card.status;
-                }
-                
-                // Update charts
-                if (card.type === 6 && card.chartData) { // CARD_CHART = 6
-                    updateChart(card.id, card.chartData);
-                }
+    if (active == rule.active) {
+        cancelRuleDelay(rule);
+        return;
+    }
+
+    // The change has to hold until the timer fires; flipping back cancels it
+    if (rule.delay > 0 && !delayElapsed) {
+        if (!timers.isScheduled(rule.delayTimer)) {
+            rule.delayTimer = timers.schedule(millis(), rule.delay, 0, [this, index]() {
+                rules[index].delayTimer = -1;
+                evaluateRule(index, true);
             });
         }
-        
-        // Update controls
-        if (data.controls) {
-            data.controls.forEach(control => {
-                updateControlUI(control.id, control.state, control.value);
-            });
+        return;
+    }
+
+    cancelRuleDelay(rule);
+    rule.active = active;
+    logToSerial("Rule " + String(index) + " on '" + card->title + "' " + (active ? "activated" : "released") +
+        " at " + String(value, 2), "RULE");
+
+    float target = active ? rule.activeValue : rule.inactiveValue;
+    if (std::isnan(target)) return;
+    for (auto& control : controls) {
+        if (control.id == rule.controlId) {
+            applyControlValue(control, target);
+            break;
         }
     }
+}
 
-    function updateChart(cardId, chartData) {
-        const canvas = document.getElementById(cardId + '_chart');
-        if (!canvas) return;
-        
-        const ctx = canvas.getContext('2d');
-        const rect = canvas.getBoundingClientRect();
-        canvas.width = rect.width;
-        canvas.height = rect.height;
-        
-        // Clear canvas
-        ctx.clearRect(0, 0, canvas.width, canvas.height);
-        
-        if (chartData.length < 2) return;
-        
-        // Find min/max values
-        const values = chartData.map(point => point.value);
-        const minValue = Math.min(...values);
-        const maxValue = Math.max(...values);
-        const range = maxValue - minValue || 1;
-        
-        // Set up drawing
-        const padding = 20;
-        const chartWidth = canvas.width - 2 * padding;
-        const chartHeight = canvas.height - 2 * padding;
-        
-        // Draw grid lines
-        ctx.strokeStyle = isDarkMode ? '#334155' : '#e2e8f0';
-        ctx.lineWidth = 1;
-        
-        // Horizontal grid lines
-        for (let i = 0; i <= 4; i++) {
-            const y = padding + (chartHeight / 4) * i;
-            ctx.beginPath();
-            ctx.moveTo(padding, y);
-            ctx.lineTo(canvas.width - padding, y);
-            ctx.stroke();
-        }
-        
-        // Draw chart line
-        ctx.strokeStyle = '#3b82f6';
-        ctx.lineWidth = 2;
-        ctx.beginPath();
-        
-        chartData.forEach((point, index) => {
-            const x = padding + (chartWidth / (chartData.length - 1)) * index;
-            const y = padding + chartHeight - ((point.value - minValue) / range) * chartHeight;
-            
-            if (index === 0) {
-                ctx.moveTo(x, y);
-            } else {
-                ctx.lineTo(x, y);
-            }
-        });
-        
-        ctx.stroke();
-        
-        // Draw data points
-        ctx.fillStyle = '#3b82f6';
-        chartData.forEach((point, index) => {
-            const x = padding + (chartWidth / (chartData.length - 1)) * index;
-            const y = padding + chartHeight - ((point.value - minValue) / range) * chartHeight;
-            
-            ctx.beginPath();
-            ctx.arc(x, y, 3, 0, 2 * Math.PI);
-            ctx.fill();
-        });
+// Timer ids are reused once their slot's generation wraps, so a stored id
+// is cleared as soon as its timer is gone
+void ESP32Dashboard::cancelRuleDelay(DashboardRule& rule) {
+    timers.cancel(rule.delayTimer);
+    rule.delayTimer = -1;
+}
+
+bool ESP32Dashboard::applyControlValue(DashboardControl& control, float value) {
+    if (control.type == CONTROL_SWITCH || control.type == CONTROL_POWER_BUTTON) {
+        if (control.state == (value != 0)) return true;
+        return applyControlCommand(control, COMMAND_TOGGLE, 0);
     }
+    if (control.type == CONTROL_BUTTON) return applyControlCommand(control, COMMAND_CLICK, 0);
+    if (control.type == CONTROL_SLIDER) return applyControlCommand(control, COMMAND_SLIDE, value);
+    if (control.type == CONTROL_SETPOINT) return applyControlCommand(control, COMMAND_SET, value);
+    return false;
+}
 
-    function updateControlUI(id, state, value) {
-        console.log(`🎛️ Updating control ${id}: state=${state}, value=${value}`);
-        
-        // Update switches
-        const switchInput = document.getElementById(id + '_input');
-        const indicator = document.getElementById(id + '_indicator');
-        const status = document.getElementById(id + '_status');
-        
-        if (switchInput) {
-            switchInput.checked = state;
-        }
-        
-        if (indicator) {
-            indicator.classList.toggle('active', state);
-        }
-        
-        if (status) {
-            status.textContent = state ? 'ON' : 'OFF';
-        }
-        
-        // Update power buttons
-        const powerButton = document.getElementById(id);
-        const powerText = document.getElementById(id + '_text');
-        const powerStatus = document.getElementById(id + '_status');
-        
-        if (powerButton && powerButton.classList.contains('power-button')) {
-            powerButton.classList.toggle('active', state);
-            if (powerText) {
-                powerText.textContent = state ? 'ON' : 'OFF';
-            }
-            if (powerStatus) {
-                powerStatus.classList.toggle('active', state);
-                powerStatus.textContent = state ? 'System Active' : 'System Inactive';
-            }
+int ESP32Dashboard::scheduleAction(const char* controlId, float value, unsigned long delay, unsigned long period) {
+    for (auto& control : controls) {
+        if (control.id != controlId) continue;
+        if (delay > DashboardTimerWheel::MAX_DELAY || period > DashboardTimerWheel::MAX_DELAY) {
+            logToSerial("Schedule for '" + String(controlId) + "': delay or period too long", "ERROR");
+            return -1;
         }
-        
-        // Update sliders
-        const sliderInput = document.getElementById(id + '_input');
-        const sliderValue = document.getElementById(id + '_value');
-        
-        if (sliderInput && sliderInput.type === 'range') {
-            sliderInput.value = value;
-        }
-        
-        if (sliderValue) {
-            sliderValue.textContent = value;
-        }
-    }
-
-    function updateConnectionStatus(connected) {
-        const statusEl = document.getElementById('connectionStatus');
-        if (statusEl) {
-            statusEl.className = connected ? 'status-indicator online' : 'status-indicator offline';
-            statusEl.innerHTML = connected ? 
-                '<div class="status-dot"></div><span>Online</span>' : 
-                '<div class="status-dot"></div><span>Offline</span>';
-        }
-    }
-
-    function toggleControl(id) {
-        console.log(`🎛️ Toggling control: ${id}`);
-        if (ws && ws.readyState === WebSocket.OPEN) {
-            const message = JSON.stringify({ id: id, action: 'toggle' });
-            ws.send(message);
-            console.log(`📤 Sent: ${message}`);
-        } else {
-            console.error('❌ WebSocket not connected');
-        }
-    }
-
-    function clickControl(id) {
-        console.log(`🔘 Clicking control: ${id}`);
-        if (ws && ws.readyState === WebSocket.OPEN) {
-            const message = JSON.stringify({ id: id, action: 'click' });
-            ws.send(message);
-            console.log(`📤 Sent: ${message}`);
-        } else {
-            console.error('❌ WebSocket not connected');
-        }
-    }
-
-    function slideControl(id, value) {
-        console.log(`🎚️ Sliding control ${id} to: ${value}`);
-        if (ws && ws.readyState === WebSocket.OPEN) {
-            const message = JSON.stringify({ id: id, action: 'slide', value: parseInt(value) });
-            ws.send(message);
-            console.log(`📤 Sent: ${message}`);
-        } else {
-            console.error('❌ WebSocket not connected');
-        }
-        
-        // Update display immediately for responsiveness
-        const valueSpan = document.getElementById(id + '_value');
-        if (valueSpan) {
-            valueSpan.textContent = value;
-        }
-    }
-
-    function toggleTheme() {
-        isDarkMode = !isDarkMode;
-        document.body.classList.toggle('dark', isDarkMode);
-        
-        const themeIcon = document.getElementById('themeIcon');
-        if (themeIcon) {
-            themeIcon.textContent = isDarkMode ? '☀️' : '🌙';
-        }
-        
-        localStorage.setItem('darkMode', isDarkMode);
-        console.log(`🎨 Theme changed to: ${isDarkMode ? 'dark' : 'light'}`);
-        
-        // Redraw charts with new theme
-        Object.keys(charts).forEach(chartId => {
-            const canvas = document.getElementById(chartId + '_chart');
-            if (canvas) {
-                // Trigger chart redraw on next update
-            }
+
+        // A one-shot drops its id from the control as it fires, so the list
+        // only ever holds live timers
+        uint16_t handle = control.handle;
+        int32_t schedule = timers.schedule(millis(), delay, period, [this, handle, value]() {
+            DashboardControl* target = findControlByHandle(handle);
+            if (!target) return;
+            pruneSchedules(*target);
+            applyControlValue(*target, value);
         });
+        if (schedule >= 0) control.schedules.push_back(schedule);
+        return schedule;
+    }
+    logToSerial("Schedule for '" + String(controlId) + "': unknown control", "ERROR");
+    return -1;
+}
+
+bool ESP32Dashboard::cancelSchedule(int schedule) {
+    // Only ids a control still holds are live; a stale one may have been
+    // reused by another timer
+    for (auto& control : controls) {
+        auto& schedules = control.schedules;
+        auto it = std::find(schedules.begin(), schedules.end(), schedule);
+        if (it == schedules.end()) continue;
+        schedules.erase(it);
+        return timers.cancel(schedule);
     }
+    return false;
+}
+
+void ESP32Dashboard::pruneSchedules(DashboardControl& control) {
+    auto& schedules = control.schedules;
+    schedules.erase(std::remove_if(schedules.begin(), schedules.end(), [this](int32_t schedule) {
+        return !timers.isScheduled(schedule);
+    }), schedules.end());
+}
+
+void ESP32Dashboard::serviceMemory() {
+    unsigned long now = millis();
+    if (lastMemorySample != 0 && now - lastMemorySample < DashboardMemory::SAMPLE_INTERVAL) return;
+    lastMemorySample = now;
 
-    function loadTheme() {
-        const savedTheme = localStorage.getItem('darkMode');
-        if (savedTheme === 'true') {
-            toggleTheme();
+    // Chart history lives as long as its card, so it is measured in place
+    size_t charts = 0;
+    for (auto& card : cards) {
+        charts += card.chartData.capacity() * sizeof(ChartDataPoint);
+        charts += card.chartTimestamps.capacity() * sizeof(uint64_t);
+        for (auto& series : card.chartSeries) charts += series.values.capacity() * sizeof(float);
+        charts += card.compressedChart.data().capacity();
+    }
+    charts += captureBlock.capacity() * sizeof(float);
+    DashboardMemory::measured(MEMORY_CHARTS, charts);
+    DashboardMemory::measured(MEMORY_RECORDER, recorder.getBytes());
+
+    memory.sampleLargestBlock(ESP.getMaxAllocHeap());
+    bool shrinking = memory.isLargestBlockShrinking();
+    if (shrinking && !memoryWarned) {
+        logToSerial("⚠️ Largest free block shrinking by " + String(-memory.getLargestBlockTrend(), 0) +
+            " bytes/hour - heap is fragmenting", "MEMORY");
+    }
+    memoryWarned = shrinking;
+}
+
+void ESP32Dashboard::handleApiRecording() {
+    // One JSON object per line, streamed so the recording is never copied whole
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(200, "application/x-ndjson", "");
+
+    for (auto& event : recorder.getEvents()) {
+        DashboardJsonDocument doc(128 + event.payload.length());
+        doc["t"] = event.time;
+        doc["type"] = DashboardRecorder::typeName(event.type);
+        if (event.client != DashboardRecorder::NO_CLIENT) {
+            doc["client"] = event.client;
         }
+        doc["data"] = event.payload;
+
+        String line;
+        serializeJson(doc, line);
+        line += "\n";
+        server->sendContent(line);
     }
+    server->sendContent("");
+}
 
-    // Add some visual feedback for button clicks
-    document.addEventListener('click', function(e) {
-        if (e.target.classList.contains('action-button') || 
-            e.target.classList.contains('power-button')) {
-            e.target.style.transform = 'scale(0.95)';
-            setTimeout(() => {
-                e.target.style.transform = '';
-            }, 150);
+bool ESP32Dashboard::getSwitchState(const char* id) {
+    for (auto& control : controls) {
+        if (control.id == id && (control.type == CONTROL_SWITCH || control.type == CONTROL_POWER_BUTTON)) {
+            return control.state;
         }
-    });
+    }
+    return false;
+}
 
-    // Handle page visibility changes
-    document.addEventListener('visibilitychange', function() {
-        if (document.hidden) {
-            console.log('📱 Page hidden - reducing update frequency');
-        } else {
-            console.log('📱 Page visible - resuming normal updates');
-            if (ws && ws.readyState !== WebSocket.OPEN) {
-                console.log('🔄 Reconnecting WebSocket...');
-                initWebSocket();
+void ESP32Dashboard::setSwitchState(const char* id, bool state) {
+    for (auto& control : controls) {
+        if (control.id == id && (control.type == CONTROL_SWITCH || control.type == CONTROL_POWER_BUTTON)) {
+            control.state = state;
+            if (control.switchCallback) {
+                control.switchCallback(state);
             }
+            break;
         }
-    });
+    }
+}
+
+int ESP32Dashboard::getSliderValue(const char* id) {
+    for (auto& control : controls) {
+        if (control.id == id && control.type == CONTROL_SLIDER) {
+            return control.value;
+        }
+    }
+    return 0;
+}
+
+void ESP32Dashboard::setSliderValue(const char* id, int value) {
+    for (auto& control : controls) {
+        if (control.id == id && control.type == CONTROL_SLIDER) {
+            control.value = constrain(value, control.minValue, control.maxValue);
+            if (control.sliderCallback) {
+                control.sliderCallback(control.value);
+            }
+            break;
+        }
+    }
+}
+
+float ESP32Dashboard::getSetpoint(const char* id) {
+    for (auto& control : controls) {
+        if (control.id == id && control.type == CONTROL_SETPOINT) {
+            return control.committedSetpoint;
+        }
+    }
+    return 0;
+}
+
+bool ESP32Dashboard::setSetpoint(const char* id, float value) {
+    for (auto& control : controls) {
+        if (control.id == id && control.type == CONTROL_SETPOINT) {
+            float setpoint;
+            if (!validateSetpoint(control, value, setpoint)) return false;
+            control.setpoint = setpoint;
+            control.committedSetpoint = setpoint;
+            control.pendingCommit = false;
+            if (control.setpointCallback) {
+                control.setpointCallback(setpoint);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void ESP32Dashboard::updateCard(const char* id, const char* value, const char* status) {
+    for (auto& card : cards) {
+        if (card.id == id) {
+            card.value = value;
+            card.valueKind = CARD_VALUE_TEXT;
+            card.formatPending = false;
+            if (status && strlen(status) > 0) {
+                card.status = status;
+            }
+            card.dirty = true;
+            break;
+        }
+    }
+}
+
+void ESP32Dashboard::updateCard(const CardHandle& handle, const char* value, const char* status) {
+    DashboardCard* card = findCard(handle);
+    if (card) updateCard(card->id.c_str(), value, status);
+}
+
+CardHandle ESP32Dashboard::getCardHandle(const char* id) {
+    CardHandle handle;
+    for (size_t i = 0; i < cards.size(); i++) {
+        if (cards[i].id == id) {
+            handle.handle = cards[i].handle;
+            handle.index = i;
+            break;
+        }
+    }
+    return handle;
+}
+
+DashboardCard* ESP32Dashboard::findCard(const char* id) {
+    for (auto& card : cards) {
+        if (card.id == id) return &card;
+    }
+    return nullptr;
+}
+
+DashboardCard* ESP32Dashboard::findCard(const CardHandle& handle) {
+    if (handle.index < cards.size() && cards[handle.index].handle == handle.handle) {
+        return &cards[handle.index];
+    }
+
+    // Cards were removed since the handle was taken; find its new position
+    for (size_t i = 0; i < cards.size(); i++) {
+        if (cards[i].handle == handle.handle) {
+            handle.index = i;
+            return &cards[i];
+        }
+    }
+    return nullptr;
+}
+
+void ESP32Dashboard::updateCard(const CardHandle& card, float value, const char* status) {
+    storeCardNumber(findCard(card), CARD_VALUE_FLOAT, value, status);
+}
+
+void ESP32Dashboard::updateCard(const CardHandle& card, bool value, const char* status) {
+    storeCardNumber(findCard(card), CARD_VALUE_BOOL, value ? 1 : 0, status);
+}
+
+void ESP32Dashboard::updateCard(const char* id, float value, const char* status) {
+    storeCardNumber(findCard(id), CARD_VALUE_FLOAT, value, status);
+}
+
+void ESP32Dashboard::updateCard(const char* id, bool value, const char* status) {
+    storeCardNumber(findCard(id), CARD_VALUE_BOOL, value ? 1 : 0, status);
+}
+
+void ESP32Dashboard::storeCardNumber(DashboardCard* card, CardValueKind kind, float value, const char* status) {
+    if (!card) return;
+    setCardNumber(*card, value);
+    card->valueKind = kind;
+    card->formatPending = true;
+    // An empty status leaves the current one, as with text updates
+    if (status && strlen(status) > 0) card->status = status;
+    card->dirty = true;
+}
+
+void ESP32Dashboard::storeCardInteger(DashboardCard* card, int32_t value, const char* status) {
+    if (!card) return;
+    card->integerValue = value;
+    storeCardNumber(card, CARD_VALUE_INT, value, status);
+}
+
+void ESP32Dashboard::beginUpdate() {
+    updateDepth++;
+}
+
+void ESP32Dashboard::commit() {
+    if (updateDepth == 0 || --updateDepth > 0) return;
+
+    for (auto& card : cards) {
+        if (card.peer.length() > 0) continue;
+        if (card.formatPending) formatCardValue(card);
+        if (card.computeCallback && card.computePending) computeCard(card);
+    }
+    if (webSocket) sendDataToClients();
+}
+
+bool ESP32Dashboard::isUpdating() {
+    return updateDepth > 0;
+}
+
+void ESP32Dashboard::setCardNumber(DashboardCard& card, float value) {
+    bool same = value == card.numericValue || (std::isnan(value) && std::isnan(card.numericValue));
+    if (same && card.revision > 0) return;
+
+    card.numericValue = value;
+    card.revision++;
+    for (auto& dependent : card.dependents) {
+        DashboardCard* target = findCard(dependent);
+        if (target) target->computePending = true;
+    }
+    queueCardRules(card);
+}
+
+void ESP32Dashboard::queueCardRules(DashboardCard& card) {
+    for (auto index : card.rules) {
+        if (rules[index].pending) continue;
+        rules[index].pending = true;
+        pendingRules.push_back(index);
+    }
+}
+
+void ESP32Dashboard::computeCard(DashboardCard& card) {
+    card.computePending = false;
+
+    computeInputs.clear();
+    for (auto& input : card.inputs) {
+        DashboardCard* source = findCard(input);
+        if (!source) {
+            setCardStale(card.id, "⚠️ Input removed");
+            return;
+        }
+        // Wait until every input has produced a value
+        if (source->revision == 0) return;
+        computeInputs.push_back(source->numericValue);
+    }
+
+    setCardNumber(card, card.computeCallback(computeInputs));
+    formatCardValue(card);
+    card.dirty = true;
+}
+
+void ESP32Dashboard::formatCardValue(DashboardCard& card, bool chart) {
+    card.formatPending = false;
+
+    if (card.valueFormatter) card.value = card.valueFormatter(card.numericValue);
+    else if (card.valueKind == CARD_VALUE_BOOL) card.value = card.numericValue != 0 ? "ON" : "OFF";
+    else if (card.valueKind == CARD_VALUE_INT) card.value = String(card.integerValue);
+    else card.value = String(card.numericValue, 2);
+
+    if (card.statusFormatter) {
+        card.status = card.statusFormatter(card.numericValue);
+    }
+    if (chart && card.type == CARD_CHART) {
+        addChartDataPoint(card, card.numericValue);
+    }
+}
+
+void ESP32Dashboard::setCardFilter(const char* id, FilterType type, int window, unsigned long sampleInterval) {
+    for (auto& card : cards) {
+        if (card.id == id) {
+            card.filter.configure(type, window);
+            card.sampleInterval = sampleInterval;
+
+            // Read at that rate between dashboard updates; without an
+            // interval the card is read once per update
+            timers.cancel(card.sampleTimer);
+            card.sampleTimer = -1;
+            if (sampleInterval > 0 && card.numericCallback) {
+                CardHandle handle;
+                handle.handle = card.handle;
+                card.sampleTimer = timers.schedule(millis(), sampleInterval, sampleInterval, [this, handle]() {
+                    DashboardCard* card = findCard(handle);
+                    if (card && !isSensorCapturing(*card)) card->filter.addSample(card->numericCallback());
+                });
+            }
+            break;
+        }
+    }
+}
+
+void ESP32Dashboard::setCardDeadband(const char* id, float absolute, float relative, unsigned long maxSilence) {
+    for (auto& card : cards) {
+        if (card.id == id) {
+            card.deadbandAbsolute = absolute;
+            card.deadbandRelative = relative;
+            card.maxSilence = maxSilence;
+            break;
+        }
+    }
+}
+
+void ESP32Dashboard::addCardSample(const char* id, float sample) {
+    for (auto& card : cards) {
+        if (card.id == id) {
+            card.filter.addSample(sample);
+            break;
+        }
+    }
+}
+
+String ESP32Dashboard::getLocalIP() {
+    return WiFi.localIP().toString();
+}
+
+bool ESP32Dashboard::isConnected() {
+    return WiFi.status() == WL_CONNECTED;
+}
+
+int ESP32Dashboard::getConnectedClients() {
+    return webSocket->connectedClients();
+}
+
+void ESP32Dashboard::handleRoot() {
+    sendAsset(DASHBOARD_INDEX_HTML_GZ, DASHBOARD_INDEX_HTML_GZ_LEN, "text/html", DASHBOARD_INDEX_HTML_VERSION, false);
+}
+
+void ESP32Dashboard::sendAsset(const uint8_t* data, size_t length, const char* contentType, const char* version, bool immutable) {
+    String etag = "\"" + String(version) + "\"";
+
+    // CSS and JS are requested with their content hash in the URL, so they can
+    // be cached for good; the shell is revalidated and usually answered with 304.
+    server->sendHeader("Cache-Control", immutable ? "public, max-age=31536000, immutable" : "no-cache");
+    server->sendHeader("ETag", etag);
+
+    if (server->header("If-None-Match") == etag) {
+        server->send(304, contentType, "");
+        return;
+    }
+
+    server->sendHeader("Content-Encoding", "gzip");
+    server->send_P(200, contentType, (const char*)data, length);
+}
+
+void ESP32Dashboard::handleApiData() {
+    size_t capacity = FRAME_CAPACITY + 256 * (cards.size() + controls.size());
+    for (auto& card : cards) capacity += cardValueCapacity(card);
+    for (auto& control : controls) capacity += controlValueCapacity(control);
+    DashboardJsonDocument doc(capacity);
+
+    JsonArray cardArray = doc.createNestedArray("cards");
+    for (auto& card : cards) {
+        JsonObject cardObj = cardArray.createNestedObject();
+        serializeCardLayout(cardObj, card);
+        serializeCardValue(cardObj, card);
+    }
+
+    JsonArray controlArray = doc.createNestedArray("controls");
+    for (auto& control : controls) {
+        JsonObject controlObj = controlArray.createNestedObject();
+        serializeControlLayout(controlObj, control);
+        serializeControlValue(controlObj, control);
+    }
+
+    doc["timestamp"] = clock.now();
+    doc["synced"] = clock.isSynced();
+    doc["connectedClients"] = webSocket->connectedClients();
+
+    if (doc.overflowed()) {
+        logToSerial("/api/data does not fit in " + String((unsigned long)capacity) + " bytes", "ERROR");
+        server->send(500, "application/json", "{\"error\":\"Out of memory\"}");
+        return;
+    }
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    server->send(200, "application/json", jsonString);
+}
+
+void ESP32Dashboard::handleApiLayout() {
+    DashboardJsonDocument doc(1024 + 256 * (cards.size() + controls.size()));
+
+    doc["title"] = dashboardTitle;
+    doc["subtitle"] = dashboardSubtitle;
+    doc["version"] = layoutVersion;
+
+    JsonArray cardArray = doc.createNestedArray("cards");
+    for (auto& card : cards) {
+        serializeCardLayout(cardArray.createNestedObject(), card);
+    }
+
+    JsonArray controlArray = doc.createNestedArray("controls");
+    for (auto& control : controls) {
+        serializeControlLayout(controlArray.createNestedObject(), control);
+    }
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    server->send(200, "application/json", jsonString);
+}
+
+void ESP32Dashboard::serializeCardLayout(JsonObject obj, const DashboardCard& card) {
+    obj["id"] = card.id;
+    obj["type"] = card.type;
+    obj["title"] = card.title;
+    obj["description"] = card.description;
+    obj["color"] = card.color;
+    obj["icon"] = card.icon;
+
+    if (card.type == CARD_MULTI_CHART) {
+        JsonArray seriesArray = obj.createNestedArray("series");
+        for (auto& series : card.chartSeries) {
+            JsonObject seriesObj = seriesArray.createNestedObject();
+            seriesObj["label"] = series.label;
+            seriesObj["color"] = series.color;
+        }
+    }
+}
+
+void ESP32Dashboard::serializeControlLayout(JsonObject obj, const DashboardControl& control) {
+    obj["id"] = control.id;
+    obj["type"] = control.type;
+    obj["title"] = control.title;
+    obj["description"] = control.description;
+    obj["color"] = control.color;
+    obj["handle"] = control.handle;
+
+    if (control.type == CONTROL_SLIDER) {
+        obj["min"] = control.minValue;
+        obj["max"] = control.maxValue;
+    }
+    else if (control.type == CONTROL_JOYSTICK) {
+        obj["rate"] = control.rate;
+    }
+    else if (control.type == CONTROL_SETPOINT) {
+        obj["min"] = control.setpointMin;
+        obj["max"] = control.setpointMax;
+        obj["step"] = control.step;
+    }
+}
+
+void ESP32Dashboard::handleApiControl() {
+    if (server->hasArg("plain")) {
+        String body = server->arg("plain");
+        recorder.record(EVENT_HTTP_CONTROL, DashboardRecorder::NO_CLIENT, body);
+
+        if (!processControlRequest(body)) {
+            server->send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+            return;
+        }
+
+        server->send(200, "application/json", "{\"status\":\"success\"}");
+        sendDataToClients();
+    }
+    else {
+        server->send(400, "application/json", "{\"error\":\"No data received\"}");
+    }
+}
+
+void ESP32Dashboard::handleApiStats() {
+    DashboardJsonDocument doc(1024);
+
+    doc["uptime"] = millis();
+    doc["clients"] = webSocket->connectedClients();
+    doc["cards"] = cards.size();
+    doc["controls"] = controls.size();
+    doc["timers"] = timers.size();
+    doc["layoutVersion"] = layoutVersion;
+    doc["updateInterval"] = updateInterval;
+
+    JsonObject heap = doc.createNestedObject("heap");
+    heap["free"] = ESP.getFreeHeap();
+    heap["minFree"] = ESP.getMinFreeHeap();
+    heap["maxAlloc"] = ESP.getMaxAllocHeap();
+    heap["size"] = ESP.getHeapSize();
+    heap["trend"] = memory.getLargestBlockTrend();
+    heap["shrinking"] = memory.isLargestBlockShrinking();
+
+    JsonObject frames = doc.createNestedObject("frames");
+    frames["seq"] = frameSequence;
+    frames["sent"] = framesSent;
+    frames["bytes"] = bytesSent;
+
+    JsonObject usage = doc.createNestedObject("memory");
+    for (int i = 0; i < MEMORY_SUBSYSTEM_COUNT; i++) {
+        MemorySubsystem subsystem = (MemorySubsystem)i;
+        JsonObject entry = usage.createNestedObject(DashboardMemory::name(subsystem));
+        entry["current"] = DashboardMemory::getCurrent(subsystem);
+        entry["peak"] = DashboardMemory::getPeak(subsystem);
+        entry["allocations"] = DashboardMemory::getAllocations(subsystem);
+    }
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    server->send(200, "application/json", jsonString);
+}
+
+bool ESP32Dashboard::processControlRequest(const String& body) {
+    DashboardJsonDocument doc(1024);
+    if (deserializeJson(doc, body)) return false;
+
+    String controlId = doc["id"];
+    String action = doc["action"];
+    applyControlAction(controlId, action, doc["x"] | (doc["value"] | 0.0f), doc["y"] | 0.0f);
+    return true;
+}
+
+void ESP32Dashboard::handleNotFound() {
+    server->send(404, "text/plain", "File Not Found");
+}
+
+void ESP32Dashboard::webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length) {
+    switch (type) {
+    case WStype_DISCONNECTED:
+        logToSerial("Client #" + String(num) + " disconnected", "WEBSOCKET");
+        recorder.record(EVENT_DISCONNECT, num, "");
+        if (onClientDisconnect) onClientDisconnect();
+        break;
+
+    case WStype_CONNECTED:
+        logToSerial("Client #" + String(num) + " connected from " + webSocket->remoteIP(num).toString(), "WEBSOCKET");
+        recorder.record(EVENT_CONNECT, num, "");
+        if (onClientConnect) onClientConnect();
+        sendSnapshot(num);
+        break;
+
+    case WStype_BIN:
+        handleBinaryCommand(num, payload, length);
+        break;
+
+    case WStype_TEXT:
+        logToSerial("Message from client #" + String(num) + ": " + String((char*)payload), "WEBSOCKET");
+        recorder.record(EVENT_WS_MESSAGE, num, String((char*)payload));
+
+        // Parsed as const so the payload stays intact for onCustomMessage
+        DashboardJsonDocument doc(512);
+        deserializeJson(doc, (const char*)payload, length);
+
+        if (doc["type"] == "snapshot") {
+            sendSnapshot(num);
+        }
+
+        if (doc.containsKey("id") && doc.containsKey("action")) {
+            String controlId = doc["id"];
+            String action = doc["action"];
+            applyControlAction(controlId, action, doc["x"] | (doc["value"] | 0.0f), doc["y"] | 0.0f);
+            sendDataToClients();
+        }
+
+        if (onCustomMessage) {
+            onCustomMessage(String((char*)payload), String(num));
+        }
+        break;
+    }
+}
+
+bool ESP32Dashboard::applyControlAction(const String& controlId, const String& action, float value, float y) {
+    uint8_t opcode = commandOpcode(action);
+    if (opcode == 0) return false;
+
+    for (auto& control : controls) {
+        if (control.id == controlId) return applyControlCommand(control, opcode, value, y);
+    }
+    return false;
+}
+
+bool ESP32Dashboard::applyControlCommand(DashboardControl& control, uint8_t opcode, float value, float y) {
+    // A mirrored control belongs to its peer; the peer's next frame
+    // reports the new state back
+    if (control.peer.length() > 0) {
+        DashboardPeer* peer = findPeer(control.peer);
+        if (!peer) return false;
+
+        String action = commandActionName(opcode);
+        DashboardJsonDocument doc(256);
+        doc["id"] = control.remoteId;
+        doc["action"] = action;
+        if (opcode == COMMAND_SLIDE) doc["value"] = (int)value;
+        if (opcode == COMMAND_SET) doc["value"] = value;
+        if (opcode == COMMAND_MOVE) {
+            doc["x"] = value;
+            doc["y"] = y;
+        }
+
+        String message;
+        serializeJson(doc, message);
+        if (opcode != COMMAND_MOVE) {
+            logToSerial("Forwarding " + action + " on '" + control.title + "' to peer '" + control.peer + "'", "HUB");
+        }
+        return peer->send(message);
+    }
+
+    if (opcode == COMMAND_TOGGLE && (control.type == CONTROL_SWITCH || control.type == CONTROL_POWER_BUTTON)) {
+        control.state = !control.state;
+        logToSerial("Control '" + control.title + "' toggled to " + String(control.state ? "ON" : "OFF"), "CONTROL");
+        if (control.switchCallback) {
+            control.switchCallback(control.state);
+        }
+    }
+    else if (opcode == COMMAND_CLICK && control.type == CONTROL_BUTTON) {
+        logToSerial("Button '" + control.title + "' clicked", "CONTROL");
+        if (control.buttonCallback) {
+            control.buttonCallback();
+        }
+    }
+    else if (opcode == COMMAND_SLIDE && control.type == CONTROL_SLIDER) {
+        if (std::isnan(value)) return false;
+        control.value = constrain((int)roundf(value), control.minValue, control.maxValue);
+        logToSerial("Slider '" + control.title + "' set to " + String(control.value), "CONTROL");
+        if (control.sliderCallback) {
+            control.sliderCallback(control.value);
+        }
+    }
+    else if (opcode == COMMAND_SET && control.type == CONTROL_SETPOINT) {
+        float setpoint;
+        if (!validateSetpoint(control, value, setpoint)) {
+            logToSerial("Setpoint '" + control.title + "' rejected a non-numeric value", "CONTROL");
+            return false;
+        }
+        if (setpoint != value) {
+            logToSerial("Setpoint '" + control.title + "' adjusted " + String(value, 3) + " to " + String(setpoint, 3), "CONTROL");
+        }
+
+        // Reported to clients right away; committed by serviceControls()
+        control.setpoint = setpoint;
+        control.pendingCommit = true;
+        control.lastInput = millis();
+    }
+    else if (opcode == COMMAND_MOVE && control.type == CONTROL_JOYSTICK) {
+        // Latest value wins: positions arriving faster than loop() runs
+        // overwrite each other and serviceControls() reports the newest
+        control.x = constrain(value, -1.0f, 1.0f);
+        control.y = constrain(y, -1.0f, 1.0f);
+        control.moved = true;
+        control.lastInput = millis();
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+DashboardControl* ESP32Dashboard::findControlByHandle(uint16_t handle) {
+    for (auto& control : controls) {
+        if (control.handle == handle) return &control;
+    }
+    return nullptr;
+}
+
+void ESP32Dashboard::handleBinaryCommand(uint8_t num, const uint8_t* payload, size_t length) {
+    // Fast path: decoded in place and looked up by handle, without a JSON document
+    DashboardCommand command;
+    if (!decodeDashboardCommand(payload, length, command)) {
+        logToSerial("Invalid binary command from client #" + String(num), "WEBSOCKET");
+        return;
+    }
+
+    DashboardControl* control = findControlByHandle(command.handle);
+    if (!control) return;
+
+    float value = command.value;
+    float y = 0;
+    if (command.opcode == COMMAND_MOVE) {
+        value = command.axes.x / (float)DASHBOARD_COMMAND_AXIS_SCALE;
+        y = command.axes.y / (float)DASHBOARD_COMMAND_AXIS_SCALE;
+    }
+
+    // Recordings hold text, so a binary command is stored as its JSON form
+    if (recorder.isRecording()) {
+        String message = "{\"id\":\"" + control->id + "\",\"action\":\"" + commandActionName(command.opcode) + "\",";
+        if (command.opcode == COMMAND_MOVE) message += "\"x\":" + String(value, 3) + ",\"y\":" + String(y, 3) + "}";
+        else message += "\"value\":" + String(value, 3) + "}";
+        recorder.record(EVENT_WS_MESSAGE, num, message);
+    }
+
+    // Joystick moves change no reported state, so they send no frame
+    if (applyControlCommand(*control, command.opcode, value, y) && command.opcode != COMMAND_MOVE) sendDataToClients();
+}
+
+void ESP32Dashboard::sendDataToClients() {
+    // An open batch is sent as a whole by commit()
+    if (updateDepth > 0) return;
+
+    unsigned long now = millis();
+    int connectedClients = webSocket->connectedClients();
+
+    // Only cards that moved beyond their deadband (or whose heartbeat is due)
+    // are sent; new clients get everything through sendSnapshot(). The frame
+    // is sized from what goes into it.
+    size_t capacity = FRAME_CAPACITY;
+    bool changed = false;
+    for (auto& card : cards) {
+        if (!cardNeedsReport(card, now)) continue;
+        capacity += cardValueCapacity(card);
+        changed = true;
+    }
+    for (auto& control : controls) {
+        if (!controlNeedsReport(control)) continue;
+        capacity += controlValueCapacity(control);
+        changed = true;
+    }
+    if (!changed && connectedClients == lastReportedClients) return;
+
+    DashboardJsonDocument doc(capacity);
+    JsonArray cardArray = doc.createNestedArray("cards");
+    for (auto& card : cards) {
+        if (cardNeedsReport(card, now)) serializeCardValue(cardArray.createNestedObject(), card);
+    }
+    JsonArray controlArray = doc.createNestedArray("controls");
+    for (auto& control : controls) {
+        if (controlNeedsReport(control)) serializeControlValue(controlArray.createNestedObject(), control);
+    }
+
+    doc["timestamp"] = clock.now();
+    doc["synced"] = clock.isSynced();
+    doc["connectedClients"] = connectedClients;
+    doc["layoutVersion"] = layoutVersion;
+    // Broadcasts are numbered so clients can tell they missed one
+    doc["seq"] = frameSequence + 1;
+
+    // Nothing is marked as reported, so the changes go out with the next frame
+    if (doc.overflowed()) {
+        logToSerial("Update frame does not fit in " + String((unsigned long)capacity) + " bytes, not sent", "ERROR");
+        return;
+    }
+
+    for (auto& card : cards) {
+        if (!cardNeedsReport(card, now)) continue;
+        if (mqttConnected) publishCardMqtt(card);
+        markCardReported(card, now);
+    }
+    for (auto& control : controls) {
+        if (!controlNeedsReport(control)) continue;
+        if (mqttConnected) publishControlMqtt(control);
+        control.reported = true;
+        control.reportedState = control.state;
+        control.reportedValue = control.value;
+        control.reportedSetpoint = control.setpoint;
+    }
+    frameSequence++;
+    lastReportedClients = connectedClients;
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    DashboardMemory::allocated(MEMORY_FRAMES, jsonString.length());
+    webSocket->broadcastTXT(jsonString);
+    DashboardMemory::released(MEMORY_FRAMES, jsonString.length());
+    framesSent += connectedClients;
+    bytesSent += jsonString.length() * connectedClients;
+    if (recorder.recordsFrames()) recorder.record(EVENT_FRAME, DashboardRecorder::NO_CLIENT, jsonString);
+}
+
+void ESP32Dashboard::sendSnapshot(uint8_t num) {
+    size_t capacity = FRAME_CAPACITY;
+    for (auto& card : cards) capacity += cardValueCapacity(card);
+    for (auto& control : controls) capacity += controlValueCapacity(control);
+    DashboardJsonDocument doc(capacity);
+
+    JsonArray cardArray = doc.createNestedArray("cards");
+    for (auto& card : cards) {
+        serializeCardValue(cardArray.createNestedObject(), card);
+    }
+
+    JsonArray controlArray = doc.createNestedArray("controls");
+    for (auto& control : controls) {
+        serializeControlValue(controlArray.createNestedObject(), control);
+    }
+
+    doc["timestamp"] = clock.now();
+    doc["synced"] = clock.isSynced();
+    doc["connectedClients"] = webSocket->connectedClients();
+    doc["layoutVersion"] = layoutVersion;
+    // The next broadcast continues from here
+    doc["seq"] = frameSequence;
+
+    if (doc.overflowed()) {
+        logToSerial("Snapshot for client #" + String(num) + " does not fit in " + String((unsigned long)capacity) + " bytes, not sent", "ERROR");
+        return;
+    }
+
+    String jsonString;
+    serializeJson(doc, jsonString);
+    DashboardMemory::allocated(MEMORY_FRAMES, jsonString.length());
+    webSocket->sendTXT(num, jsonString);
+    DashboardMemory::released(MEMORY_FRAMES, jsonString.length());
+    framesSent++;
+    bytesSent += jsonString.length();
+    if (recorder.recordsFrames()) recorder.record(EVENT_FRAME, num, jsonString);
+}
+
+void ESP32Dashboard::serializeCardValue(JsonObject obj, const DashboardCard& card) {
+    obj["id"] = card.id;
+    obj["value"] = card.value;
+    obj["status"] = card.staleStatus.length() > 0 ? card.staleStatus : card.status;
+    obj["type"] = card.type;
+
+    if (card.peer.length() > 0) {
+        if (card.mirrorData.length() > 0) {
+            DashboardJsonDocument extra(256 + card.mirrorData.length() * 3);
+            deserializeJson(extra, card.mirrorData);
+            for (JsonPair field : extra.as<JsonObject>()) {
+                obj[field.key()] = field.value();
+            }
+        }
+        return;
+    }
+
+    if (card.compressedChart.getMode() != CHART_COMPRESSION_NONE) {
+        // The stored byte stream is sent as is, together with the row it
+        // is relative to: base = [timestamp, column...]
+        const DashboardChartBuffer& chart = card.compressedChart;
+        obj["enc"] = chart.getMode();
+        obj["p"] = chart.getPrecision();
+        obj["rows"] = chart.size();
+        JsonArray base = obj.createNestedArray("base");
+        base.add(chart.getBaseTimestamp());
+        for (auto column : chart.getBaseColumns()) {
+            if (chart.getMode() == CHART_COMPRESSION_XOR) base.add((uint32_t)column);
+            else base.add((int64_t)column);
+        }
+        obj["data"] = DashboardCodec::base64Encode(chart.data().data(), chart.data().size());
+    }
+    else if (card.type == CARD_CHART) {
+        JsonArray chartArray = obj.createNestedArray("chartData");
+        for (auto& point : card.chartData) {
+            JsonObject pointObj = chartArray.createNestedObject();
+            pointObj["timestamp"] = point.timestamp;
+            pointObj["value"] = point.value;
+        }
+    }
+    else if (card.type == CARD_MULTI_CHART) {
+        // Column-oriented: the timestamps are sent once for all series
+        JsonArray timeArray = obj.createNestedArray("t");
+        for (auto timestamp : card.chartTimestamps) {
+            timeArray.add(timestamp);
+        }
+        JsonArray seriesArray = obj.createNestedArray("series");
+        for (auto& series : card.chartSeries) {
+            JsonArray valueArray = seriesArray.createNestedArray();
+            for (auto value : series.values) {
+                valueArray.add(value);
+            }
+        }
+    }
+}
+
+size_t ESP32Dashboard::cardValueCapacity(const DashboardCard& card) {
+    // Slots plus copies of the strings; chart histories and mirrored cards
+    // are what make a card large
+    size_t size = JSON_OBJECT_SIZE(12) + card.id.length() + card.value.length() + 3 +
+        std::max(card.status.length(), card.staleStatus.length());
+
+    if (card.peer.length() > 0) {
+        size += 256 + card.mirrorData.length() * 3;
+    }
+    else if (card.compressedChart.getMode() != CHART_COMPRESSION_NONE) {
+        size += JSON_ARRAY_SIZE(card.compressedChart.getBaseColumns().size() + 1) + (card.compressedChart.data().size() + 2) / 3 * 4 + 1;
+    }
+    else if (card.type == CARD_CHART) {
+        size += JSON_ARRAY_SIZE(card.chartData.size()) + card.chartData.size() * JSON_OBJECT_SIZE(2);
+    }
+    else if (card.type == CARD_MULTI_CHART) {
+        size += JSON_ARRAY_SIZE(card.chartTimestamps.size()) + JSON_ARRAY_SIZE(card.chartSeries.size());
+        for (auto& series : card.chartSeries) size += JSON_ARRAY_SIZE(series.values.size());
+    }
+    return size;
+}
+
+size_t ESP32Dashboard::controlValueCapacity(const DashboardControl& control) {
+    return JSON_OBJECT_SIZE(3) + control.id.length() + 1;
+}
+
+bool ESP32Dashboard::controlNeedsReport(const DashboardControl& control) {
+    return !control.reported || control.reportedState != control.state || control.reportedValue != control.value ||
+        control.reportedSetpoint != control.setpoint;
+}
+
+void ESP32Dashboard::serializeControlValue(JsonObject obj, const DashboardControl& control) {
+    obj["id"] = control.id;
+    obj["state"] = control.state;
+    if (control.type == CONTROL_SETPOINT) obj["value"] = control.setpoint;
+    else obj["value"] = control.value;
+}
+
+bool ESP32Dashboard::cardNeedsReport(const DashboardCard& card, unsigned long now) {
+    if (!card.reported) return true;
+    if (card.maxSilence > 0 && now - card.reportedAt >= card.maxSilence) return true;
+    if (!card.dirty) return false;
+
+    // Charts gain a point on every update, so any refresh is a change
+    if (card.type == CARD_CHART || card.type == CARD_MULTI_CHART) return true;
+
+    // A new status, or a value turning NaN/inf or back, always goes out;
+    // the deadband only holds back small moves between finite values
+    if (card.status != card.reportedStatus) return true;
+    if (std::isfinite(card.numericValue) != std::isfinite(card.reportedNumeric)) return true;
+
+    bool numeric = card.numericCallback || card.filter.hasValue() || card.valueKind != CARD_VALUE_TEXT;
+    if (numeric && (card.deadbandAbsolute > 0 || card.deadbandRelative > 0)) {
+        float threshold = std::max(card.deadbandAbsolute, card.deadbandRelative * fabsf(card.reportedNumeric));
+        return fabsf(card.numericValue - card.reportedNumeric) > threshold;
+    }
+
+    return card.value != card.reportedValue || card.status != card.reportedStatus;
+}
 
-    console.log('🚀 Dashboard JavaScript initialized');
-  )rawliteral";
+void ESP32Dashboard::markCardReported(DashboardCard& card, unsigned long now) {
+    card.reported = true;
+    card.reportedAt = now;
+    card.reportedNumeric = card.numericValue;
+    card.reportedValue = card.value;
+    card.reportedStatus = card.status;
+    card.dirty = false;
 }
@@ -4,8 +4,34 @@
 #include <WiFi.h>
 #include <WebServer.h>
 #include <WebSocketsServer.h>
+// Frame and chart timestamps are 64-bit milliseconds
+#ifndef ARDUINOJSON_USE_LONG_LONG
+#define ARDUINOJSON_USE_LONG_LONG 1
+#endif
 #include <ArduinoJson.h>
+// A sketch that included ArduinoJson first, or configured it, gets the
+// library's default instead; every translation unit has to agree
+#if !ARDUINOJSON_USE_LONG_LONG
+#error "ESP32Dashboard needs ARDUINOJSON_USE_LONG_LONG=1: include ESP32Dashboard.h before ArduinoJson.h or define it in the build flags"
+#endif
 #include <functional>
+#include <type_traits>
+#include <initializer_list>
+#include "DashboardFilter.h"
+#include "DashboardCapture.h"
+#include "DashboardChartBuffer.h"
+#include "DashboardClock.h"
+#include "DashboardPeer.h"
+#include "DashboardEspNow.h"
+#include "DashboardMqtt.h"
+#include "DashboardModbus.h"
+#include "DashboardRecorder.h"
+#include "DashboardMemory.h"
+#include "DashboardCommand.h"
+#include "DashboardTimerWheel.h"
+
+// JSON documents are accounted to the JSON memory subsystem
+typedef BasicJsonDocument<DashboardJsonAllocator> DashboardJsonDocument;
 
 // Card types
 enum CardType {
@@ -15,7 +41,24 @@ enum CardType {
 	CARD_CUSTOM,
 	CARD_STATUS,
 	CARD_PERCENTAGE,
-	CARD_CHART
+	CARD_CHART,
+	CARD_MULTI_CHART
+};
+
+// How a card's value was last set: as text, or as a number that is
+// formatted once per update (typed updateCard() overloads)
+enum CardValueKind {
+	CARD_VALUE_TEXT,
+	CARD_VALUE_FLOAT,
+	CARD_VALUE_INT,
+	CARD_VALUE_BOOL
+};
+
+// Returned by getCardHandle(); stays valid for the life of the card. The
+// index is only a hint and is looked up again after cards are removed.
+struct CardHandle {
+	uint16_t handle = 0xFFFF;
+	mutable uint16_t index = 0;
 };
 
 // Control types
@@ -23,15 +66,38 @@ enum ControlType {
 	CONTROL_SWITCH,
 	CONTROL_BUTTON,
 	CONTROL_POWER_BUTTON,
-	CONTROL_SLIDER
+	CONTROL_SLIDER,
+	CONTROL_JOYSTICK,
+	CONTROL_SETPOINT
 };
 
 // Chart data point
 struct ChartDataPoint {
-	unsigned long timestamp;
+	uint64_t timestamp;
 	float value;
 };
 
+// Multi-series chart column; all series of a card share its timestamps
+struct ChartSeries {
+	String label;
+	String color;
+	std::function<float()> callback;
+	std::vector<float> values;
+};
+
+// ESP-NOW sensor node and the cards its reading channels feed
+struct EspNowNode {
+	String name;
+	uint8_t mac[6];
+	unsigned long staleAfter;
+	unsigned long lastSeen = 0;
+	uint16_t lastSequence = 0;
+	uint32_t packets = 0;
+	uint32_t lost = 0;
+	bool stale = false;
+	std::vector<std::pair<uint8_t, String>> channels;
+};
+
 // Card structure
 struct DashboardCard {
 	String id;
@@ -45,7 +111,63 @@ struct DashboardCard {
 	std::function<String()> valueCallback;
 	std::function<String()> statusCallback;
 	std::vector<ChartDataPoint> chartData;
+	std::vector<uint64_t> chartTimestamps;
+	std::vector<ChartSeries> chartSeries;
+	DashboardChartBuffer compressedChart;
 	int maxDataPoints;
+
+	// Numeric cards: the sensor is read once per sample and the cached
+	// (filtered) value is formatted for display
+	std::function<float()> numericCallback;
+	std::function<String(float)> valueFormatter;
+	std::function<String(float)> statusFormatter;
+	float numericValue = 0;
+	DashboardFilter filter;
+	unsigned long sampleInterval = 0;
+	int32_t sampleTimer = -1;
+
+	// Change reporting: dirty marks a refresh since the last frame, the
+	// deadband decides whether the refresh is significant enough to send
+	bool dirty = false;
+	float deadbandAbsolute = 0;
+	float deadbandRelative = 0;
+	unsigned long maxSilence = 0;
+	bool reported = false;
+	unsigned long reportedAt = 0;
+	float reportedNumeric = 0;
+	String reportedValue;
+	String reportedStatus;
+
+	// Typed updates store the number and leave formatting to the next update
+	CardValueKind valueKind = CARD_VALUE_TEXT;
+	int32_t integerValue = 0;
+	bool formatPending = false;
+	uint16_t handle = 0;
+
+	// Bumped whenever numericValue actually changes; dependents are the
+	// computed cards that read this one and are marked for recomputation,
+	// rules the automation rules that are queued for evaluation
+	uint32_t revision = 0;
+	std::vector<CardHandle> dependents;
+	std::vector<uint16_t> rules;
+
+	// Computed cards: a function of other cards' cached values, recomputed
+	// only when one of the inputs changed
+	std::vector<CardHandle> inputs;
+	std::function<float(const std::vector<float>&)> computeCallback;
+	bool computePending = false;
+
+	// Sent instead of the status while the card's data source is overdue
+	String staleStatus;
+
+	// First of the two Modbus input registers holding numericValue
+	int modbusRegister = -1;
+
+	// Hub mode: the peer this card mirrors (empty for local cards), the id
+	// it has there and any chart fields of its last update, relayed as is
+	String peer;
+	String remoteId;
+	String mirrorData;
 };
 
 // Control structure
@@ -62,6 +184,74 @@ struct DashboardControl {
 	std::function<void(bool)> switchCallback;
 	std::function<void(int)> sliderCallback;
 	std::function<void()> buttonCallback;
+	std::function<void(float, float)> joystickCallback;
+	std::function<void(float)> setpointCallback;
+	bool reported = false;
+	bool reportedState = false;
+	int reportedValue = 0;
+
+	// Hub mode: actions on a mirrored control are forwarded to its peer
+	String peer;
+	String remoteId;
+
+	// Joystick: latest position (-1..1 per axis) and the rate (Hz) the
+	// browser streams it at while the stick is held
+	float x = 0;
+	float y = 0;
+	bool moved = false;
+	int rate = 0;
+
+	// Setpoint: values are checked against min/max/step on the device and
+	// committed to the callback once left alone for debounce ms
+	float setpoint = 0;
+	float setpointMin = 0;
+	float setpointMax = 0;
+	float step = 0;
+	unsigned long debounce = 0;
+	float committedSetpoint = 0;
+	bool pendingCommit = false;
+	float reportedSetpoint = 0;
+
+	// Last joystick move or setpoint change
+	unsigned long lastInput = 0;
+
+	// Binary command protocol address, stable for the life of the control
+	uint16_t handle = 0;
+
+	// Live timers from scheduleAction(), cancelled with the control; fired
+	// one-shots and cancelled schedules are removed
+	std::vector<int32_t> schedules;
+
+	// Modbus coil (switches, buttons) or holding register (sliders)
+	int modbusAddress = -1;
+};
+
+// Rule conditions on a card's numeric value
+enum RuleCondition {
+	RULE_ABOVE,
+	RULE_BELOW
+};
+
+// Automation rule: while the card's value is past the threshold the control
+// is driven to activeValue, and back to inactiveValue (if not NaN) once the
+// value has returned past threshold -/+ hysteresis. Both changes must hold
+// for delay ms before they are acted on.
+struct DashboardRule {
+	CardHandle card;
+	RuleCondition condition;
+	float threshold;
+	float hysteresis;
+	unsigned long delay;
+	String controlId;
+	float activeValue;
+	float inactiveValue;
+	bool enabled = true;
+	bool active = false;
+
+	// Queued for evaluation because the input changed; delayTimer runs
+	// while a change is holding for delay ms and is -1 otherwise
+	bool pending = false;
+	int32_t delayTimer = -1;
 };
 
 class ESP32Dashboard {
@@ -71,6 +261,46 @@ private:
 
 	std::vector<DashboardCard> cards;
 	std::vector<DashboardControl> controls;
+	std::vector<DashboardRule> rules;
+	std::vector<uint16_t> pendingRules;
+	unsigned int nextCardIndex;
+	unsigned int nextControlIndex;
+	unsigned long layoutVersion;
+
+	DashboardCapture capture;
+	bool captureActive;
+	String captureCardId;
+	// The burst reads the card's own sensor, so loop() leaves it alone
+	bool captureSharesSensor;
+	uint64_t captureStartedAt;
+	std::vector<float> captureBlock;
+
+	std::vector<DashboardPeer*> peers;
+
+	DashboardEspNow espNow;
+	std::vector<EspNowNode> espNowNodes;
+
+	DashboardMqttTransport* mqtt;
+	String mqttBaseTopic;
+	bool mqttConnected;
+	unsigned long mqttLastAttempt;
+
+	DashboardModbus* modbus;
+	uint16_t nextModbusRegister;
+	uint16_t nextModbusCoil;
+	uint16_t nextModbusHolding;
+	uint16_t nextControlHandle;
+	uint16_t nextCardHandle;
+	int updateDepth;
+
+	DashboardRecorder recorder;
+
+	DashboardMemory memory;
+	unsigned long lastMemorySample;
+	bool memoryWarned;
+
+	// Filter sampling, rule delays and scheduled actions
+	DashboardTimerWheel timers;
 
 	String ssid;
 	String password;
@@ -80,6 +310,11 @@ private:
 
 	unsigned long lastUpdate;
 	unsigned long updateInterval;
+	DashboardClock clock;
+	int lastReportedClients;
+	uint32_t frameSequence;
+	uint32_t framesSent;
+	uint32_t bytesSent;
 
 	bool serialMonitoring;
 	unsigned long serialBaudRate;
@@ -88,16 +323,72 @@ private:
 
 	void handleRoot();
 	void handleApiData();
+	void handleApiLayout();
 	void handleApiControl();
+	void handleApiRecording();
+	void handleApiStats();
+	bool processControlRequest(const String& body);
+	void serviceReplay();
+	void serviceMemory();
 	void handleNotFound();
 	void webSocketEvent(uint8_t num, WStype_t type, uint8_t* payload, size_t length);
+	bool applyControlAction(const String& controlId, const String& action, float value, float y = 0);
+	bool applyControlCommand(DashboardControl& control, uint8_t opcode, float value, float y = 0);
+	void serviceControls();
+	DashboardCard* findCard(const char* id);
+	DashboardCard* findCard(const CardHandle& handle);
+	void storeCardNumber(DashboardCard* card, CardValueKind kind, float value, const char* status);
+	void storeCardInteger(DashboardCard* card, int32_t value, const char* status);
+	void formatCardValue(DashboardCard& card, bool chart = true);
+	void setCardNumber(DashboardCard& card, float value);
+	void queueCardRules(DashboardCard& card);
+	void computeCard(DashboardCard& card);
+	std::vector<float> computeInputs;
+	void serviceRules();
+	void evaluateRule(uint16_t index, bool delayElapsed);
+	void cancelRuleDelay(DashboardRule& rule);
+	void pruneSchedules(DashboardControl& control);
+	bool applyControlValue(DashboardControl& control, float value);
+	bool validateSetpoint(const DashboardControl& control, float value, float& result);
+	DashboardControl* findControlByHandle(uint16_t handle);
+	void handleBinaryCommand(uint8_t num, const uint8_t* payload, size_t length);
 	void sendDataToClients();
-	String generateHTML();
-	String generateCards();
-	String generateControls();
-	String generateCSS();
-	String generateJavaScript();
-	void addChartDataPoint(const char* cardId, float value);
+	void sendSnapshot(uint8_t num);
+	void serializeCardValue(JsonObject obj, const DashboardCard& card);
+	void serializeControlValue(JsonObject obj, const DashboardControl& control);
+	bool cardNeedsReport(const DashboardCard& card, unsigned long now);
+	bool controlNeedsReport(const DashboardControl& control);
+	size_t cardValueCapacity(const DashboardCard& card);
+	size_t controlValueCapacity(const DashboardControl& control);
+	void markCardReported(DashboardCard& card, unsigned long now);
+	void sendAsset(const uint8_t* data, size_t length, const char* contentType, const char* version, bool immutable);
+	void serializeCardLayout(JsonObject obj, const DashboardCard& card);
+	void serializeControlLayout(JsonObject obj, const DashboardControl& control);
+	void sampleCards();
+	bool isSensorCapturing(const DashboardCard& card);
+	void addChartDataPoint(DashboardCard& card, float value);
+	void sampleMultiChart(DashboardCard& card);
+	void serviceCapture();
+	void publishCapture();
+	String registerCard(DashboardCard& card);
+	String registerControl(DashboardControl& control);
+	void publishLayoutChange(const char* op, const char* kind, const DashboardCard* card, const DashboardControl* control);
+	DashboardPeer* findPeer(const String& name);
+	void servicePeers();
+	void handlePeerMessage(DashboardPeer& peer, uint8_t* payload, size_t length);
+	void handlePeerConnection(DashboardPeer& peer, bool connected);
+	void syncPeerLayout(DashboardPeer& peer, JsonObject layout);
+	void removePeerWidgets(const String& name, JsonObject layout);
+	void serviceEspNow();
+	void handleEspNowPacket(const uint8_t* mac, const DashboardEspNowPacket& packet);
+	void setCardStale(const String& id, const String& staleStatus);
+	void serviceMqtt();
+	void publishCardMqtt(const DashboardCard& card);
+	void publishControlMqtt(const DashboardControl& control);
+	void handleMqttMessage(const String& topic, const String& payload);
+	bool readModbusInput(uint16_t address, uint16_t& value);
+	bool writeModbusCoil(uint16_t address, bool value);
+	bool writeModbusHolding(uint16_t address, uint16_t value);
 
 public:
 	ESP32Dashboard();
@@ -107,6 +398,13 @@ public:
 	bool begin(const char* ssid, const char* password, int port = 80, int wsPort = 81);
 	void setTitle(const char* title, const char* subtitle = "");
 	void setUpdateInterval(unsigned long interval);
+
+	// Wall-clock timestamps: once synced, frames and charts carry Unix epoch
+	// milliseconds; before that, milliseconds since boot
+	void enableTimeSync(const char* ntpServer = "pool.ntp.org", const char* ntpServer2 = nullptr);
+	void setTimeSource(std::function<uint64_t()> source);
+	bool isTimeSynced();
+	uint64_t getTimestamp();
 	void loop();
 
 	// Card management
@@ -117,22 +415,157 @@ public:
 	String addPercentageCard(const char* title, const char* description, std::function<int()> callback, const char* color = "green");
 	String addCustomCard(const char* title, const char* description, std::function<String()> valueCallback, std::function<String()> statusCallback, const char* color = "purple", const char* icon = "");
 	String addChartCard(const char* title, const char* description, std::function<float()> callback, const char* color = "blue", int maxPoints = 20);
+	String addMultiChartCard(const char* title, const char* description, int maxPoints = 20);
+	bool addChartSeries(const char* chartId, const char* label, std::function<float()> callback, const char* color = "blue");
+	// Computed card: compute() gets the current values of the input cards (in
+	// the order given) and runs only when one of them changed, never reading
+	// a sensor itself. Inputs must already exist, so computed cards can build
+	// on each other without cycles. Returns "" if an input is unknown.
+	String addComputedCard(const char* title, const char* description, std::initializer_list<const char*> inputs, std::function<float(const std::vector<float>&)> compute, std::function<String(float)> formatter = nullptr, const char* color = "blue", const char* icon = "🧮");
+
+	// Stores (and sends) a chart's history compressed: DELTA quantizes values
+	// to precision decimals, XOR keeps full float precision
+	void setChartCompression(const char* chartId, ChartCompression mode, int precision = 2);
 
 	// Control management
 	String addSwitch(const char* title, const char* description, std::function<void(bool)> callback, const char* color = "blue");
 	String addButton(const char* title, const char* description, std::function<void()> callback, const char* color = "green");
 	String addPowerButton(const char* title, const char* description, std::function<void(bool)> callback);
 	String addSlider(const char* title, const char* description, std::function<void(int)> callback, int min = 0, int max = 100, const char* color = "blue");
+	// 2-axis joystick; the browser streams the position at up to rate Hz
+	// while it is held and the callback gets the latest one once per loop().
+	// The stick recentres if the stream stops for five periods.
+	String addJoystick(const char* title, const char* description, std::function<void(float, float)> callback, const char* color = "blue", int rate = 20);
+	// Numeric setpoint (PID targets and the like): values outside min..max
+	// are clamped and snapped to step on the device, and the callback only
+	// gets a value after debounce ms without further changes
+	String addSetpoint(const char* title, const char* description, std::function<void(float)> callback, float initial, float min, float max, float step = 0.1, const char* color = "blue", unsigned long debounce = 500);
+
+	// Runtime layout changes (pushed to connected clients without a reload)
+	bool removeCard(const char* id);
+	bool removeControl(const char* id);
 
 	// State management
 	bool getSwitchState(const char* id);
 	void setSwitchState(const char* id, bool state);
 	int getSliderValue(const char* id);
 	void setSliderValue(const char* id, int value);
+	float getSetpoint(const char* id);
+	bool setSetpoint(const char* id, float value);
+
+	// Automation rules, evaluated only when their card's value changes.
+	// Switches are turned on for a non-zero value and off for zero, buttons
+	// are clicked, sliders and setpoints are set to the value. A stale card
+	// (overdue ESP-NOW node, removed input) does not drive its rules.
+	// Returns the rule number, or -1 if the card or control is unknown or the
+	// delay exceeds the timer limit (see scheduleAction()).
+	int addRule(const char* cardId, RuleCondition condition, float threshold, const char* controlId, float activeValue, float inactiveValue = NAN, float hysteresis = 0, unsigned long delay = 0);
+	void setRuleEnabled(int rule, bool enabled);
+	bool isRuleActive(int rule);
+
+	// Drives a control after delay ms, then every period ms if period > 0,
+	// the same way a rule does. Removing the control cancels its schedules.
+	// delay and period are limited to 2^31 - 1 ms (about 24.8 days). Returns
+	// an id for cancelSchedule(), or -1 if the control is unknown or a time
+	// is out of range.
+	int scheduleAction(const char* controlId, float value, unsigned long delay, unsigned long period = 0);
+	bool cancelSchedule(int schedule);
 
 	// Card value updates
 	void updateCard(const char* id, const char* value, const char* status = "");
 
+	// Typed updates: the number is stored as is (no formatting, no heap) and
+	// formatted with the card's formatter on the next update, so they are
+	// cheap enough for a fast control loop. Bools show as ON/OFF. Status is
+	// only changed when given.
+	CardHandle getCardHandle(const char* id);
+	void updateCard(const CardHandle& card, const char* value, const char* status = "");
+	void updateCard(const CardHandle& card, float value, const char* status = nullptr);
+	void updateCard(const CardHandle& card, double value, const char* status = nullptr) { updateCard(card, (float)value, status); }
+	void updateCard(const CardHandle& card, bool value, const char* status = nullptr);
+	template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+	void updateCard(const CardHandle& card, T value, const char* status = nullptr) { storeCardInteger(findCard(card), (int32_t)value, status); }
+	void updateCard(const char* id, float value, const char* status = nullptr);
+	void updateCard(const char* id, double value, const char* status = nullptr) { updateCard(id, (float)value, status); }
+	void updateCard(const char* id, bool value, const char* status = nullptr);
+	template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+	void updateCard(const char* id, T value, const char* status = nullptr) { storeCardInteger(findCard(id), (int32_t)value, status); }
+
+	// Batched updates: between beginUpdate() and commit() no frame is sent,
+	// so related cards never reach clients half-updated; commit() sends all
+	// of them in one frame. Batches nest (the outermost commit() sends).
+	// Call from the same task as loop().
+	void beginUpdate();
+	void commit();
+	bool isUpdating();
+
+	// Sensor smoothing: sampleInterval > 0 reads the card's sensor at that rate
+	// between updates, 0 reads it once per update
+	void setCardFilter(const char* id, FilterType type, int window = 10, unsigned long sampleInterval = 0);
+	void addCardSample(const char* id, float sample);
+
+	// Significant-change reporting: a numeric card is only sent when it moves
+	// more than max(absolute, relative * |last sent value|); maxSilence > 0
+	// re-sends it at least that often (ms)
+	void setCardDeadband(const char* id, float absolute, float relative = 0, unsigned long maxSilence = 0);
+
+	// High-rate capture: samples a chart card in a fixed-rate burst (timer
+	// driven, defaults to the card's own callback, which loop() then leaves
+	// alone until the burst is done) and sends the whole block
+	// to the chart when done. One capture runs at a time. Returns false if
+	// samples exceeds DashboardCapture::MAX_SAMPLES or the free heap.
+	bool startCapture(const char* chartId, uint32_t sampleRate, uint32_t samples, std::function<float()> sampler = nullptr);
+	bool isCapturing();
+
+	// Hub mode: mirrors another dashboard's cards and controls (ids prefixed
+	// with "name.") over a single WebSocket to it, relaying only what changed
+	// and forwarding control actions back
+	bool addPeer(const char* name, const char* host, uint16_t port = 80, uint16_t wsPort = 81);
+	bool removePeer(const char* name);
+	int getConnectedPeers();
+
+	// ESP-NOW ingestion: sensor nodes send batched readings
+	// (DashboardEspNowPacket) and each mapped channel feeds its card like
+	// addCardSample(). Cards of a node silent for staleAfter ms show it as stale.
+	bool enableEspNow();
+	bool addEspNowNode(const char* name, const uint8_t* mac, unsigned long staleAfter = 60000);
+	bool mapEspNowChannel(const char* node, uint8_t channel, const char* cardId);
+	bool isEspNowNodeStale(const char* node);
+
+	// MQTT bridge: publishes changed cards to <base>/card/<id> and controls to
+	// <base>/control/<id> (retained JSON, same change detection as the web
+	// UI) and applies messages on <base>/control/<id>/set. The transport is
+	// owned by the caller.
+	void enableMqtt(DashboardMqttTransport& transport, const char* baseTopic = "esp32dashboard");
+	bool isMqttConnected();
+
+	// Modbus TCP server: every card except multi-series charts is a 32-bit
+	// float in two input registers (high word first), NaN until the card has
+	// a numeric value (text-only and hub-mirrored cards never do), switches
+	// and buttons are coils, sliders are holding registers. Addresses are
+	// given out in registration order and never reused; getModbusAddress()
+	// looks them up.
+	bool enableModbus(uint16_t port = 502);
+	int getModbusAddress(const char* id);
+
+	// Binary command protocol: a WebSocket binary frame carrying a
+	// DashboardCommand is applied without parsing JSON. Controls are addressed
+	// by handle, given out in registration order and never reused.
+	int getControlHandle(const char* id);
+
+	// Session recording: inbound control traffic (WebSocket and HTTP), client
+	// connects/disconnects and optionally every outbound frame, kept in RAM
+	// within maxBytes (oldest dropped first) and served at /api/recording.
+	// replayRecording() feeds the recorded inbound events back through the
+	// live handlers at their original pace, scaled by speed. Recorded client
+	// connects are not replayed into the socket layer. startRecording() returns
+	// false while a replay is running, since it would discard the recording.
+	bool startRecording(size_t maxBytes = 16384, bool includeFrames = false);
+	void stopRecording();
+	bool isRecording();
+	bool replayRecording(float speed = 1.0);
+	bool isReplaying();
+
 	// Utility functions
 	String getLocalIP();
 	bool isConnected();